@@ -19,6 +19,10 @@
  */
 
 #include "automate.h"
+#include "automate_compile.h"
+#include "sous_ensembles.h"
+#include "couples.h"
+#include "produit.h"
 #include "table.h"
 #include "ensemble.h"
 #include "outils.h"
@@ -97,24 +101,64 @@ Cle * copier_cle( const Cle* cle ){
   return creer_cle( cle->origine, cle->lettre );
 }
 
+/* Crée un ensemble d'entiers avec le mode d'allocation de l'automate.
+ */
+Ensemble * creer_ensemble_automate( const Automate * automate ){
+  if( automate->arena ){
+    return creer_ensemble_dans_pool( automate->arena, NULL, NULL, NULL );
+  }
+  return creer_ensemble( NULL, NULL, NULL );
+}
+
+/* Dans une arena, les clés de la table des transitions sont allouées par
+ * ajouter_transition() dans l'arena et ne sont donc pas copiées par la table.
+ * L'index inverse est une table de même nature, dont les clés (fin, lettre)
+ * sont rangées dans des Cle.
+ */
+static Table * creer_table_transitions( const Automate * automate ){
+  if( automate->arena ){
+    return creer_table_dans_pool(
+				 automate->arena,
+				 ( int(*)(const intptr_t, const intptr_t) ) comparer_cle , 
+				 NULL, NULL
+				 );
+  }
+  return creer_table(
+		     ( int(*)(const intptr_t, const intptr_t) ) comparer_cle , 
+		     ( intptr_t (*)( const intptr_t ) ) copier_cle,
+		     ( void(*)(intptr_t) ) supprimer_cle
+		     );
+}
+
+void initialiser_automate( Automate * automate ){
+  automate->etats = creer_ensemble_automate( automate );
+  automate->alphabet = creer_ensemble_automate( automate );
+  automate->transitions = creer_table_transitions( automate );
+  automate->transitions_inverses = NULL;
+  automate->initiaux = creer_ensemble_automate( automate );
+  automate->finaux = creer_ensemble_automate( automate );
+  automate->vide = creer_ensemble_automate( automate ); 
+}
+
 Automate * creer_automate(){
   Automate * automate = xmalloc( sizeof(Automate) );
-  automate->etats = creer_ensemble( NULL, NULL, NULL );
-  automate->alphabet = creer_ensemble( NULL, NULL, NULL );
-  automate->transitions = creer_table(
-				      ( int(*)(const intptr_t, const intptr_t) ) comparer_cle , 
-				      ( intptr_t (*)( const intptr_t ) ) copier_cle,
-				      ( void(*)(intptr_t) ) supprimer_cle
-				      );
-  automate->initiaux = creer_ensemble( NULL, NULL, NULL );
-  automate->finaux = creer_ensemble( NULL, NULL, NULL );
-  automate->vide = creer_ensemble( NULL, NULL, NULL ); 
+  automate->arena = NULL;
+  initialiser_automate( automate );
   return automate;
 }
 
-Automate * translater_automate_entier( const Automate* automate, int translation ){
-  Automate * res = creer_automate();
+Automate * creer_automate_arena(){
+  Automate * automate = xmalloc( sizeof(Automate) );
+  automate->arena = creer_pool();
+  initialiser_automate( automate );
+  return automate;
+}
 
+/* Ajoute à res une copie translatée de l'automate passé en paramètre.
+ */
+void ajouter_automate_translate(
+    Automate * res, const Automate* automate, int translation
+){
   Ensemble_iterateur it;
   for( 
       it = premier_iterateur_ensemble( get_etats( automate ) );
@@ -169,13 +213,23 @@ Automate * translater_automate_entier( const Automate* automate, int translation
 			 );
     }
   };
+}
 
+Automate * translater_automate_entier( const Automate* automate, int translation ){
+  Automate * res = creer_automate();
+  ajouter_automate_translate( res, automate, translation );
   return res;
 }
 
 
-void liberer_automate( Automate * automate ){
-  assert( automate );
+/* Libère les structures de l'automate, mais pas l'automate lui-même. Pour 
+ * une arena, tout est rendu en bloc avec les tronçons de l'arena.
+ */
+void detruire_structures_automate( Automate * automate ){
+  if( automate->arena ){
+    vider_pool( automate->arena );
+    return;
+  }
   liberer_ensemble( automate->vide );
   liberer_ensemble( automate->finaux );
   liberer_ensemble( automate->initiaux );
@@ -183,11 +237,36 @@ void liberer_automate( Automate * automate ){
 			  automate->transitions, ( void(*)(intptr_t) ) liberer_ensemble
 			  );
   liberer_table( automate->transitions );
+  if( automate->transitions_inverses ){
+    pour_toute_valeur_table(
+			    automate->transitions_inverses, 
+			    ( void(*)(intptr_t) ) liberer_ensemble
+			    );
+    liberer_table( automate->transitions_inverses );
+  }
   liberer_ensemble( automate->alphabet );
   liberer_ensemble( automate->etats );
+}
+
+void liberer_automate( Automate * automate ){
+  assert( automate );
+  detruire_structures_automate( automate );
+  if( automate->arena ){
+    liberer_pool( automate->arena );
+  }
   xfree(automate);
 }
 
+void vider_automate( Automate * automate ){
+  assert( automate );
+  int indexe = automate->transitions_inverses != NULL;
+  detruire_structures_automate( automate );
+  initialiser_automate( automate );
+  if( indexe ){
+    indexer_antecedents( automate );
+  }
+}
+
 const Ensemble * get_etats( const Automate* automate ){
   return automate->etats;
 }
@@ -212,24 +291,77 @@ void ajouter_lettre( Automate * automate, char lettre ){
   ajouter_element( automate->alphabet, lettre );
 }
 
+/* Ajoute 'fin' à l'ensemble associé à la clé (origine, lettre) de la 
+ * table, qui est la table des transitions ou l'index inverse.
+ */
+static void ajouter_dans_table_transitions(
+  Automate * automate, Table * table, int origine, char lettre, int fin
+){
+  Cle cle;
+  intptr_t fins;
+  initialiser_cle( &cle, origine, lettre );
+  Ensemble * ens;
+  if( trouver_valeur_table( table, (intptr_t) &cle, &fins ) ){
+    ens = (Ensemble*) fins;
+  }else{
+    ens = creer_ensemble_automate( automate );
+    if( automate->arena ){
+      Cle * cle_arena = allouer_pool( automate->arena, sizeof(Cle) );
+      *cle_arena = cle;
+      add_table( table, (intptr_t) cle_arena, (intptr_t) ens );
+    }else{
+      add_table( table, (intptr_t) &cle, (intptr_t) ens );
+    }
+  }
+  ajouter_element( ens, fin );
+}
+
 void ajouter_transition(
 			Automate * automate, int origine, char lettre, int fin
 			){
   ajouter_etat( automate, origine );
   ajouter_etat( automate, fin );
   ajouter_lettre( automate, lettre );
+  ajouter_dans_table_transitions( 
+    automate, automate->transitions, origine, lettre, fin 
+  );
+  if( automate->transitions_inverses ){
+    ajouter_dans_table_transitions( 
+      automate, automate->transitions_inverses, fin, lettre, origine 
+    );
+  }
+}
+
+static void action_indexer_antecedent( int origine, char lettre, int fin, void* data ){
+  Automate * automate = (Automate *) data;
+  ajouter_dans_table_transitions( 
+    automate, automate->transitions_inverses, fin, lettre, origine 
+  );
+}
+
+void indexer_antecedents( Automate * automate ){
+  if( automate->transitions_inverses ){
+    return;
+  }
+  automate->transitions_inverses = creer_table_transitions( automate );
+  pour_toute_transition( automate, action_indexer_antecedent, automate );
+}
 
+const Ensemble * antecedents( const Automate* automate, int fin, char lettre ){
+  if( ! automate->transitions_inverses ){
+    ERREUR( "L'index inverse de l'automate n'a pas été construit." );
+  }
   Cle cle;
-  initialiser_cle( &cle, origine, lettre );
-  Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
-  Ensemble * ens;
-  if( iterateur_est_vide( it ) ){
-    ens = creer_ensemble( NULL, NULL, NULL );
-    add_table( automate->transitions, (intptr_t) &cle, (intptr_t) ens );
-  }else{
-    ens = (Ensemble*) get_valeur( it );
+  intptr_t origines;
+  initialiser_cle( &cle, fin, lettre );
+  if( 
+      trouver_valeur_table( 
+	automate->transitions_inverses, (intptr_t) &cle, &origines 
+      ) 
+      ){
+    return (Ensemble*) origines;
   }
-  ajouter_element( ens, fin );
+  return automate->vide;
 }
 
 void ajouter_etat_final(
@@ -248,10 +380,10 @@ void ajouter_etat_initial(
 
 const Ensemble * voisins( const Automate* automate, int origine, char lettre ){
   Cle cle;
+  intptr_t fins;
   initialiser_cle( &cle, origine, lettre );
-  Table_iterateur it = trouver_table( automate->transitions, (intptr_t) &cle );
-  if( ! iterateur_est_vide( it ) ){
-    return (Ensemble*) get_valeur( it );
+  if( trouver_valeur_table( automate->transitions, (intptr_t) &cle, &fins ) ){
+    return (Ensemble*) fins;
   }else{
     return automate->vide;
   }
@@ -285,21 +417,29 @@ Ensemble * delta(
   return res;
 }
 
-Ensemble * delta_star(
-		      const Automate* automate, const Ensemble * etats_courants, const char* mot
-		      ){
-  int len = strlen( mot );
-  int i;
+Ensemble * delta_star_octets(
+			     const Automate* automate, const Ensemble * etats_courants,
+			     const uint8_t* mot, size_t taille
+			     ){
+  size_t i;
   Ensemble * old = copier_ensemble( etats_courants );
   Ensemble * new = old;
-  for( i=0; i<len; i++ ){
-    new = delta( automate, old, *(mot+i) );
+  for( i=0; i<taille; i++ ){
+    new = delta( automate, old, (char) mot[i] );
     liberer_ensemble( old );
     old = new;
   }
   return new;
 }
 
+Ensemble * delta_star(
+		      const Automate* automate, const Ensemble * etats_courants, const char* mot
+		      ){
+  return delta_star_octets( 
+    automate, etats_courants, (const uint8_t*) mot, strlen( mot ) 
+  );
+}
+
 void pour_toute_transition(
 			   const Automate* automate,
 			   void (* action )( int origine, char lettre, int fin, void* data ),
@@ -381,21 +521,28 @@ Automate* copier_automate( const Automate* automate ){
   return res;
 }
 
-Automate * translater_automate(
-			       const Automate * automate, const Automate * automate_a_eviter
-			       ){
+/* Renvoie la translation utilisée par translater_automate().
+ */
+int translation_pour_eviter(
+    const Automate * automate, const Automate * automate_a_eviter
+){
   if(
      taille_ensemble( get_etats(automate) ) == 0 ||
      taille_ensemble( get_etats(automate_a_eviter) ) == 0
      ){
-    return copier_automate( automate );
+    return 0;
   }
-	
-  int translation = 
-    get_max_etat( automate_a_eviter ) - get_min_etat( automate ) + 1; 
+  return get_max_etat( automate_a_eviter ) - get_min_etat( automate ) + 1; 
+}
 
+Automate * translater_automate(
+			       const Automate * automate, const Automate * automate_a_eviter
+			       ){
+  int translation = translation_pour_eviter( automate, automate_a_eviter );
+  if( translation == 0 ){
+    return copier_automate( automate );
+  }
   return translater_automate_entier( automate, translation );
-	
 }
 
 int est_une_transition_de_l_automate(
@@ -448,8 +595,12 @@ void print_automate( const Automate * automate ){
   printf("\n");
 }
 
-int le_mot_est_reconnu( const Automate* automate, const char* mot ){
-  Ensemble * arrivee = delta_star( automate, get_initiaux(automate) , mot ); 
+int le_mot_est_reconnu_octets( 
+			      const Automate* automate, const uint8_t* mot, size_t taille 
+			      ){
+  Ensemble * arrivee = delta_star_octets( 
+    automate, get_initiaux(automate), mot, taille 
+  ); 
 	
   int result = 0;
 
@@ -468,6 +619,12 @@ int le_mot_est_reconnu( const Automate* automate, const char* mot ){
   return result;
 }
 
+int le_mot_est_reconnu( const Automate* automate, const char* mot ){
+  return le_mot_est_reconnu_octets( 
+    automate, (const uint8_t*) mot, strlen( mot ) 
+  );
+}
+
 Automate * mot_to_automate( const char * mot ){
   Automate * automate = creer_automate();
   int i = 0;
@@ -488,8 +645,13 @@ Automate * creer_union_des_automates(
 				     const Automate * automate_1, const Automate * automate_2
 				     ){
   Automate* ret = creer_automate();
-  /* On évite le cas où les automates ont des états qui ont le meme numéro */
-  Automate* automate_2bis = translater_automate(automate_2,automate_1);
+  /* On évite le cas où les automates ont des états qui ont le meme numéro. 
+   * La copie translatée est temporaire : elle est construite dans une arena.
+   */
+  Automate* automate_2bis = creer_automate_arena();
+  ajouter_automate_translate(
+    automate_2bis, automate_2, translation_pour_eviter( automate_2, automate_1 )
+  );
 
   Ensemble const* etats_1 = get_etats(automate_1);
   Ensemble const* etats_2 = get_etats(automate_2bis);
@@ -556,59 +718,452 @@ Automate * creer_union_des_automates(
   ret->finaux = etats_fin;  
   return ret;
 }
-/* pour chaque etats :
- * utilise la fonction delta1 appliquée sur chaque lettre de l'alphabet
- * creation d'un ensemble local (propre à l'état) d'états accessibles
- * fonction auxiliaire relancé sur tout les états n'ayant pas encore été traité. 
-*/
-Ensemble * aux_etats_accessibles(const Automate * automate, const Ensemble * alphabet, int etat, Ensemble * etatsAcc){
-  Ensemble * etatsAccLocaux = creer_ensemble(NULL,NULL,NULL);
+/* Graphe des transitions, sans les lettres : les états sont numérotés 
+ * dans l'ordre croissant et les successeurs de l'état d'indice i sont
+ * successeurs[ debuts[i] ], ..., successeurs[ debuts[i+1] - 1 ] (de même 
+ * pour les prédécesseurs, si le graphe inverse a été demandé).
+ */
+typedef struct {
+  int nb_etats;
+  int * etats;
+  int nb_arcs;
+  int * origines;
+  int * fins;
+  int * debuts;
+  int * successeurs;
+  int * debuts_inverses;
+  int * predecesseurs;
+} Graphe_transitions;
+
+static int indice_etat_graphe( const Graphe_transitions * g, int etat ){
+  int debut = 0, fin = g->nb_etats;
+  while( debut < fin ){
+    int milieu = debut + ( fin - debut ) / 2;
+    if( g->etats[milieu] < etat ){
+      debut = milieu + 1;
+    }else{
+      fin = milieu;
+    }
+  }
+  if( debut < g->nb_etats && g->etats[debut] == etat ){
+    return debut;
+  }
+  return -1;
+}
+
+static void action_relever_arc( int origine, char lettre, int fin, void * data ){
+  Graphe_transitions * g = (Graphe_transitions *) data;
+  g->origines[ g->nb_arcs ] = indice_etat_graphe( g, origine );
+  g->fins[ g->nb_arcs ] = indice_etat_graphe( g, fin );
+  g->nb_arcs++;
+}
+
+/* Range les arcs par 'depuis' (tri par dénombrement) : les 'vers' des 
+ * arcs partant de i sont voisins[ debuts[i] .. debuts[i+1] [.
+ */
+static void ranger_arcs( 
+  const Graphe_transitions * g, const int * depuis, const int * vers,
+  int ** debuts, int ** voisins
+){
+  *debuts = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+  memset( *debuts, 0, ( g->nb_etats + 1 ) * sizeof(int) );
+  *voisins = xmalloc( ( g->nb_arcs + 1 ) * sizeof(int) );
+  for( int k = 0; k < g->nb_arcs; k++ ){
+    (*debuts)[ depuis[k] + 1 ]++;
+  }
+  for( int i = 0; i < g->nb_etats; i++ ){
+    (*debuts)[i+1] += (*debuts)[i];
+  }
+  int * curseurs = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+  memcpy( curseurs, *debuts, ( g->nb_etats + 1 ) * sizeof(int) );
+  for( int k = 0; k < g->nb_arcs; k++ ){
+    (*voisins)[ curseurs[ depuis[k] ]++ ] = vers[k];
+  }
+  xfree( curseurs );
+}
+
+/* Construit le graphe en un seul parcours des transitions, qui relève les
+ * arcs ; les listes de successeurs (et de prédécesseurs si 'avec_inverse')
+ * en sont déduites par dénombrement.
+ */
+static void construire_graphe_transitions( 
+  Graphe_transitions * g, const Automate * automate, int avec_inverse
+){
+  const Ensemble * etats = get_etats( automate );
+  g->nb_etats = taille_ensemble( etats );
+  g->etats = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+  int n = 0;
   Ensemble_iterateur it;
-  
-  for(it = premier_iterateur_ensemble(alphabet);
-      ! iterateur_ensemble_est_vide(it);
-      it = iterateur_suivant_ensemble(it)){
-    Ensemble * etats_acc_depuis_lettre = delta1(automate,etat,get_element(it));
-    ajouter_elements(etatsAccLocaux, etats_acc_depuis_lettre);
-    liberer_ensemble(etats_acc_depuis_lettre);
-  }
-  Ensemble * etatsNonTraites = creer_difference_ensemble(etatsAccLocaux,etatsAcc);
-  ajouter_elements(etatsAcc,etatsAccLocaux);
-  liberer_ensemble(etatsAccLocaux);
-  for(it = premier_iterateur_ensemble(etatsNonTraites);
-      ! iterateur_ensemble_est_vide(it);
-      it = iterateur_suivant_ensemble(it)){
-    ajouter_elements(etatsAcc, aux_etats_accessibles(automate,alphabet,get_element(it),etatsAcc));
-  }
-  liberer_ensemble(etatsNonTraites);
-  return etatsAcc;
-}
-  
-					  				 
-Ensemble * etats_accessibles( const Automate * automate, int etat ){
-  Ensemble * etatsAcc = creer_ensemble(NULL,NULL,NULL);
-  ajouter_element(etatsAcc,etat);
-  const Ensemble * alphabet = get_alphabet(automate);
-  return aux_etats_accessibles(automate, alphabet, etat, etatsAcc);
+  for(
+      it = premier_iterateur_ensemble( etats );
+      ! iterateur_ensemble_est_vide( it );
+      it = iterateur_suivant_ensemble( it )
+      ){
+    g->etats[ n++ ] = get_element( it );
+  }
+  size_t nb_transitions = 0;
+  Table_iterateur it_trans;
+  for(
+      it_trans = premier_iterateur_table( automate->transitions );
+      ! iterateur_est_vide( it_trans );
+      it_trans = iterateur_suivant_table( it_trans )
+      ){
+    nb_transitions += taille_ensemble( (Ensemble*) get_valeur( it_trans ) );
+  }
+  g->nb_arcs = 0;
+  g->origines = xmalloc( ( nb_transitions + 1 ) * sizeof(int) );
+  g->fins = xmalloc( ( nb_transitions + 1 ) * sizeof(int) );
+  pour_toute_transition( automate, action_relever_arc, g );
+  ranger_arcs( g, g->origines, g->fins, &g->debuts, &g->successeurs );
+  g->debuts_inverses = NULL;
+  g->predecesseurs = NULL;
+  if( avec_inverse ){
+    ranger_arcs( 
+      g, g->fins, g->origines, &g->debuts_inverses, &g->predecesseurs 
+    );
+  }
+}
+
+static void liberer_graphe_transitions( Graphe_transitions * g ){
+  xfree( g->etats );
+  xfree( g->origines );
+  xfree( g->fins );
+  xfree( g->debuts );
+  xfree( g->successeurs );
+  if( g->debuts_inverses ){
+    xfree( g->debuts_inverses );
+    xfree( g->predecesseurs );
+  }
+}
+
+static int est_marque( const uint64_t * marques, int e ){
+  return ( marques[ e / 64 ] >> ( e % 64 ) ) & 1;
+}
+
+/* Parcours en largeur depuis les états de 'depart', avec une file 
+ * (un tableau, chaque état y entre au plus une fois) et un tableau de bits 
+ * des états déjà vus : chaque état et chaque arc sont examinés une seule 
+ * fois. Renvoie le tableau de bits des états atteints, indexé comme 
+ * g->etats.
+ */
+static uint64_t * parcourir_graphe_transitions(
+  const Graphe_transitions * g, const int * debuts, const int * voisins, 
+  const Ensemble * depart 
+){
+  uint64_t * vus = xmalloc( ( g->nb_etats / 64 + 1 ) * sizeof(uint64_t) );
+  memset( vus, 0, ( g->nb_etats / 64 + 1 ) * sizeof(uint64_t) );
+  int * file = xmalloc( ( g->nb_etats + 1 ) * sizeof(int) );
+  int nb = 0;
+  Ensemble_iterateur it;
+  for(
+      it = premier_iterateur_ensemble( depart );
+      ! iterateur_ensemble_est_vide( it );
+      it = iterateur_suivant_ensemble( it )
+      ){
+    int e = indice_etat_graphe( g, get_element( it ) );
+    if( e >= 0 && ! est_marque( vus, e ) ){
+      vus[ e / 64 ] |= (uint64_t) 1 << ( e % 64 );
+      file[ nb++ ] = e;
+    }
+  }
+  for( int i = 0; i < nb; i++ ){
+    int e = file[i];
+    for( int k = debuts[e]; k < debuts[e+1]; k++ ){
+      int t = voisins[k];
+      if( ! est_marque( vus, t ) ){
+	vus[ t / 64 ] |= (uint64_t) 1 << ( t % 64 );
+	file[ nb++ ] = t;
+      }
     }
+  }
+  xfree( file );
+  return vus;
+}
 
-/* Pour récupérer les états accessibles depuis les états initiaux, 
- * en se servant donc de etats_accessibles sur les états initiaux 
-*/
+/* Les états de départ qui n'appartiennent pas à l'automate font partie du
+ * résultat, sans successeur.
+ */
+static Ensemble * etats_marques( 
+  const Graphe_transitions * g, const uint64_t * marques, 
+  const Ensemble * depart 
+){
+  Ensemble * res = copier_ensemble( depart );
+  for( int e = 0; e < g->nb_etats; e++ ){
+    if( est_marque( marques, e ) ){
+      ajouter_element( res, g->etats[e] );
+    }
+  }
+  return res;
+}
+
+static int comparer_entiers( const void * a, const void * b ){
+  int x = *(const int *) a;
+  int y = *(const int *) b;
+  return ( x > y ) - ( x < y );
+}
+
+/* Les clés de la table des transitions sont rangées par origine, puis par 
+ * lettre : les transitions qui partent de 'origine' se suivent, et la 
+ * première est trouvée par une recherche dans la table.
+ */
+static void pour_toute_transition_depuis(
+  const Automate* automate, int origine,
+  void (* action )( int origine, char lettre, int fin, void* data ),
+  void* data
+){
+  Cle debut = { origine, INT_MIN };
+  Table_iterateur it1;
+  Ensemble_iterateur it2;
+  for(
+      it1 = trouver_table_a_partir( automate->transitions, (intptr_t) &debut );
+      ! iterateur_est_vide( it1 ) && ( (Cle*) get_cle( it1 ) )->origine == origine;
+      it1 = iterateur_suivant_table( it1 )
+      ){
+    Cle * cle = (Cle*) get_cle( it1 );
+    Ensemble * fins = (Ensemble*) get_valeur( it1 );
+    for(
+	it2 = premier_iterateur_ensemble( fins );
+	! iterateur_ensemble_est_vide( it2 );
+	it2 = iterateur_suivant_ensemble( it2 )
+	){
+      action( origine, cle->lettre, get_element( it2 ), data );
+    }
+  }
+}
+
+/* Parcours en largeur : les états atteints sont rangés dans 'vus' (des 
+ * couples (etat, 0)) dans l'ordre où on les découvre, une seule fois 
+ * chacun ; ce tableau sert de file. Seules les transitions qui partent des
+ * états atteints sont lues.
+ *
+ * Si 'arcs' n'est pas NULL, on garde pour le k-ième état atteint le numéro
+ * de l'état dont il vient (parents[k], -1 pour un état de départ) et la 
+ * lettre lue (lettres[k]). Si 'arret_sur_final', le parcours s'arrête au 
+ * premier état final atteint, dont le numéro est écrit dans 'final'.
+ */
+struct parcours_en_largeur {
+  const Automate * automate;
+  Couples vus;
+  int arcs;
+  long * parents;
+  char * lettres;
+  size_t capacite;
+  long courant;
+  int arret_sur_final;
+  long final;
+};
+
+static void initialiser_parcours( 
+  struct parcours_en_largeur * p, const Automate * automate, int arcs,
+  int arret_sur_final
+){
+  p->automate = automate;
+  initialiser_couples( &p->vus );
+  p->arcs = arcs;
+  p->parents = NULL;
+  p->lettres = NULL;
+  p->capacite = 0;
+  p->courant = -1;
+  p->arret_sur_final = arret_sur_final;
+  p->final = -1;
+}
+
+static void detruire_parcours( struct parcours_en_largeur * p ){
+  detruire_couples( &p->vus );
+  xfree( p->parents );
+  xfree( p->lettres );
+}
+
+static void decouvrir_etat( 
+  struct parcours_en_largeur * p, int etat, char lettre 
+){
+  if( p->final >= 0 || ! ajouter_couple( &p->vus, etat, 0 ) ){
+    return;
+  }
+  size_t k = nb_couples( &p->vus ) - 1;
+  if( p->arcs ){
+    if( k == p->capacite ){
+      p->capacite = p->capacite ? 2 * p->capacite : 16;
+      p->parents = xrealloc( p->parents, p->capacite * sizeof(long) );
+      p->lettres = xrealloc( p->lettres, p->capacite );
+    }
+    p->parents[k] = p->courant;
+    p->lettres[k] = lettre;
+  }
+  if( 
+      p->arret_sur_final 
+      && est_un_etat_final_de_l_automate( p->automate, etat ) 
+      ){
+    p->final = k;
+  }
+}
+
+static void action_decouvrir_fin( int origine, char lettre, int fin, void * data ){
+  decouvrir_etat( (struct parcours_en_largeur *) data, fin, lettre );
+}
+
+static void parcourir_en_largeur( 
+  struct parcours_en_largeur * p, const Ensemble * depart 
+){
+  Ensemble_iterateur it;
+  for(
+      it = premier_iterateur_ensemble( depart );
+      ! iterateur_ensemble_est_vide( it );
+      it = iterateur_suivant_ensemble( it )
+      ){
+    decouvrir_etat( p, get_element( it ), '\0' );
+  }
+  for( 
+      p->courant = 0; 
+      (size_t) p->courant < nb_couples( &p->vus ) && p->final < 0; 
+      p->courant++ 
+      ){
+    int etat, zero;
+    get_couple( &p->vus, p->courant, &etat, &zero );
+    pour_toute_transition_depuis( p->automate, etat, action_decouvrir_fin, p );
+  }
+}
+
+static Ensemble * etats_accessibles_depuis( 
+  const Automate * automate, const Ensemble * depart 
+){
+  struct parcours_en_largeur p;
+  initialiser_parcours( &p, automate, 0, 0 );
+  parcourir_en_largeur( &p, depart );
+  // Les états sont ajoutés à l'ensemble dans l'ordre croissant : chaque 
+  // insertion suit le même chemin de l'arbre, déjà en cache.
+  size_t nb = nb_couples( &p.vus );
+  int * etats = xmalloc( ( nb + 1 ) * sizeof(int) );
+  for( size_t i = 0; i < nb; i++ ){
+    int zero;
+    get_couple( &p.vus, i, &etats[i], &zero );
+  }
+  detruire_parcours( &p );
+  qsort( etats, nb, sizeof(int), comparer_entiers );
+  Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+  for( size_t i = 0; i < nb; i++ ){
+    ajouter_element( res, etats[i] );
+  }
+  xfree( etats );
+  return res;
+}
 
+Ensemble * etats_accessibles( const Automate * automate, int etat ){
+  Ensemble * depart = creer_ensemble( NULL, NULL, NULL );
+  ajouter_element( depart, etat );
+  Ensemble * res = etats_accessibles_depuis( automate, depart );
+  liberer_ensemble( depart );
+  return res;
+}
+
+/* Tous les états initiaux partent ensemble dans un seul parcours.
+*/
 Ensemble* accessibles( const Automate * automate ){
- 	Ensemble* ret = copier_ensemble(get_initiaux(automate));
- 	Ensemble_iterateur it;
- 	for(
- 		it = premier_iterateur_ensemble(get_initiaux(automate)); 
- 		! iterateur_est_vide(it);
- 		it = iterateur_suivant_ensemble(it)
- 		){
-	  Ensemble * etats_acc = etats_accessibles(automate,get_element(it));
-	  ajouter_elements(ret,etats_acc);
-	  liberer_ensemble(etats_acc);
- }
- return ret;
+  return etats_accessibles_depuis( automate, get_initiaux( automate ) );
+}
+
+/* Même parcours que accessibles(), sur le graphe inverse et depuis les
+ * états finaux.
+ */
+Ensemble* coaccessibles( const Automate * automate ){
+  Graphe_transitions g;
+  construire_graphe_transitions( &g, automate, 1 );
+  uint64_t * vus = parcourir_graphe_transitions( 
+    &g, g.debuts_inverses, g.predecesseurs, get_finaux( automate ) 
+  );
+  Ensemble * res = etats_marques( &g, vus, get_finaux( automate ) );
+  xfree( vus );
+  liberer_graphe_transitions( &g );
+  return res;
+}
+
+/* Un état est utile s'il est accessible et co-accessible. On garde les 
+ * états utiles et les transitions entre deux états utiles ; l'alphabet est 
+ * conservé. Les arcs relevés dans le graphe suivent l'ordre de 
+ * pour_toute_transition() : le second parcours des transitions n'a donc 
+ * pas à rechercher les indices des états.
+ */
+struct emondage{
+  const Graphe_transitions * graphe;
+  const uint64_t * utiles;
+  int arc;
+  Automate * automate_emonde;
+};
+static void action_copier_transition_utile( int origine, char lettre, int fin, void * data ){
+  struct emondage * e = (struct emondage *) data;
+  int k = e->arc++;
+  if( 
+      est_marque( e->utiles, e->graphe->origines[k] ) 
+      && est_marque( e->utiles, e->graphe->fins[k] ) 
+      ){
+    ajouter_transition( e->automate_emonde, origine, lettre, fin );
+  }
+}
+
+Automate *automate_emonde( const Automate * automate ){
+  Graphe_transitions g;
+  construire_graphe_transitions( &g, automate, 1 );
+  uint64_t * utiles = parcourir_graphe_transitions( 
+    &g, g.debuts, g.successeurs, get_initiaux( automate ) 
+  );
+  uint64_t * coaccessibles = parcourir_graphe_transitions( 
+    &g, g.debuts_inverses, g.predecesseurs, get_finaux( automate ) 
+  );
+  for( int i = 0; i <= g.nb_etats / 64; i++ ){
+    utiles[i] &= coaccessibles[i];
+  }
+  xfree( coaccessibles );
+
+  Automate * ret = creer_automate();
+  ajouter_elements( ret->alphabet, get_alphabet( automate ) );
+  for( int e = 0; e < g.nb_etats; e++ ){
+    if( est_marque( utiles, e ) ){
+      ajouter_etat( ret, g.etats[e] );
+      if( est_un_etat_initial_de_l_automate( automate, g.etats[e] ) ){
+	ajouter_etat_initial( ret, g.etats[e] );
+      }
+      if( est_un_etat_final_de_l_automate( automate, g.etats[e] ) ){
+	ajouter_etat_final( ret, g.etats[e] );
+      }
+    }
+  }
+  struct emondage data = { &g, utiles, 0, ret };
+  pour_toute_transition( automate, action_copier_transition_utile, &data );
+  xfree( utiles );
+  liberer_graphe_transitions( &g );
+  return ret;
+}
+
+int langage_est_vide( const Automate * automate ){
+  struct parcours_en_largeur p;
+  initialiser_parcours( &p, automate, 0, 1 );
+  parcourir_en_largeur( &p, get_initiaux( automate ) );
+  int res = p.final < 0;
+  detruire_parcours( &p );
+  return res;
+}
+
+/* Le parcours en largeur atteint chaque état par un plus court chemin : on 
+ * remonte les arcs qui ont mené à l'état final trouvé.
+ */
+char * plus_court_mot_reconnu( const Automate * automate ){
+  struct parcours_en_largeur p;
+  initialiser_parcours( &p, automate, 1, 1 );
+  parcourir_en_largeur( &p, get_initiaux( automate ) );
+  char * res = NULL;
+  if( p.final >= 0 ){
+    int longueur = 0;
+    for( long k = p.final; p.parents[k] >= 0; k = p.parents[k] ){
+      longueur++;
+    }
+    res = xmalloc( longueur + 1 );
+    res[ longueur ] = '\0';
+    for( long k = p.final; p.parents[k] >= 0; k = p.parents[k] ){
+      res[ --longueur ] = p.lettres[k];
+    }
+  }
+  detruire_parcours( &p );
+  return res;
 }
 
 struct suppr_transition{
@@ -650,7 +1205,25 @@ Automate *miroir( const Automate * automate){
 	liberer_ensemble(ret->finaux);
 	ret->initiaux = copier_ensemble(get_finaux(automate));
 	ret->finaux = copier_ensemble(get_initiaux(automate));
+	ajouter_elements(ret->etats, get_etats(automate));
+	ajouter_elements(ret->alphabet, get_alphabet(automate));
 	Table_iterateur it_trans;
+	if( automate->transitions_inverses ){
+		/* Les entrées de l'index inverse sont exactement celles de la table
+		 * des transitions du miroir.
+		 */
+		for(
+			it_trans = premier_iterateur_table(automate->transitions_inverses);
+			!iterateur_est_vide(it_trans); 
+			it_trans = iterateur_suivant_table(it_trans)
+			){
+			add_table( 
+				ret->transitions, get_cle( it_trans ),
+				(intptr_t) copier_ensemble( (Ensemble*) get_valeur( it_trans ) )
+			);
+		}
+		return ret;
+	}
 	Ensemble_iterateur it_ens;
 	for(
 		it_trans = premier_iterateur_table(automate->transitions);
@@ -671,95 +1244,590 @@ Automate *miroir( const Automate * automate){
 	return ret;
 }
 
+/* L'index inverse du miroir est la table des transitions de l'automate : 
+ * il suffit d'échanger les pointeurs.
+ */
+void miroir_en_place( Automate * automate ){
+	indexer_antecedents( automate );
+	Table * transitions = automate->transitions;
+	automate->transitions = automate->transitions_inverses;
+	automate->transitions_inverses = transitions;
+	Ensemble * initiaux = automate->initiaux;
+	automate->initiaux = automate->finaux;
+	automate->finaux = initiaux;
+}
 
-/* Afin de créer l'automate du mélange on crée les états produits 
-   des automates A1 et A2 (i,j) tq i et j appartiennent respectivement à A1 et A2.
 
-   Ensuite, nous ajoutons une transition (p,a,q)
-   (a un mot de l'union des alphabet de A1 et A2, p = (i,j) et q = (i',j'))
-   Si et seulement si il existe une transition (i,a,i') ou (j,a,j')
+/* Classe de la lettre dense l dans un automate compilé. */
+static int classe_lettre( const Automate_compile * a, int l ){
+  return a->classe[ (unsigned char) a->lettres[l] ];
+}
 
-   Les états initiaux de cet automate sont les couples (i,j) tq i et j initiaux
-   (de même pour les finals). 
+/* L'automate du mélange est la partie accessible du produit PRODUIT_MELANGE
+   de A1 et A2 : depuis p = (i,j), on ajoute une transition (p,a,q) avec 
+   q = (i',j) pour toute transition (i,a,i') de A1, et avec q = (i,j') pour 
+   toute transition (j,a,j') de A2.
 
-   Convention de nommage : l'état (i,j) est représenté par l'entier : (i << 16) + j  
+   Les états initiaux de cet automate sont les couples (i,j) tq i et j initiaux
+   (de même pour les finals). Les couples sont numérotés 0, 1, ... dans 
+   l'ordre où ils sont découverts (voir construire_produit()).
 */
-
-int nommer_etat(int i,int j){
-  return (i << 16) + j;
-}
 Automate * creer_automate_du_melange(
 	const Automate* automate_1,  const Automate* automate_2
 	){
-  Automate * automate_melange = creer_automate();
-  Ensemble const * etats_1 = get_etats(automate_1);
-  Ensemble const * etats_2 = get_etats(automate_2);
-  Ensemble const * alphabet_1 = get_alphabet(automate_1);
-  Ensemble const * alphabet_2 = get_alphabet(automate_2);
-  Ensemble const * initiaux_1 = get_initiaux(automate_1);
-  Ensemble const * initiaux_2 = get_initiaux(automate_2);
-  Ensemble const * finaux_1 = get_finaux(automate_1);
-  Ensemble const * finaux_2 = get_finaux(automate_2);
-  Ensemble * initiaux_melange, * finaux_melange;
-  initiaux_melange = creer_ensemble(NULL,NULL,NULL);
-  finaux_melange = creer_ensemble(NULL,NULL,NULL);
-  Ensemble * etats_accessibles;
-	
-  Ensemble_iterateur it1, it2, it_alph1, it_alph2, it_access;
+  Produit * produit = creer_produit( automate_1, automate_2, PRODUIT_MELANGE );
+  Automate * automate_melange = construire_produit( produit );
+  liberer_produit( produit );
+  return automate_melange;
+}
 
-  for(
-      it1 = premier_iterateur_ensemble(etats_1);
-      !iterateur_ensemble_est_vide(it1);
-      it1 = iterateur_suivant_ensemble(it1)){
-    for(
-	it2 = premier_iterateur_ensemble(etats_2);
-	!iterateur_ensemble_est_vide(it2);
-	it2 = iterateur_suivant_ensemble(it2)){
-      int i = get_element(it1);
-      int j = get_element(it2);
-      for(
-	  it_alph1 = premier_iterateur_ensemble(alphabet_1);
-	  !iterateur_ensemble_est_vide(it_alph1);
-	  it_alph1 = iterateur_suivant_ensemble(it_alph1)){
-	etats_accessibles = delta1(automate_1, i,get_element(it_alph1));
-	for(
-	    it_access = premier_iterateur_ensemble(etats_accessibles);
-	    !iterateur_ensemble_est_vide(it_access);
-	    it_access = iterateur_suivant_ensemble(it_access)){
-	  ajouter_transition(automate_melange,nommer_etat(i,j), get_element(it_alph1) , nommer_etat(get_element(it_access), j));
+/* Pour savoir si un mot est dans le mélange, on simule l'automate du 
+ * mélange sans le construire : la frontière est l'ensemble des couples 
+ * (i,j) d'indices d'états compilés atteints après la lecture d'un préfixe 
+ * du mot. Chaque couple n'est rangé qu'une fois par position.
+ */
+int le_mot_est_dans_le_melange(
+	const Automate* automate_1, const Automate* automate_2, const char* mot
+	){
+  Automate_compile * a1 = compiler_automate( automate_1 );
+  Automate_compile * a2 = compiler_automate( automate_2 );
+  Couples frontieres[2];
+  initialiser_couples( &frontieres[0] );
+  initialiser_couples( &frontieres[1] );
+  Couples * courante = &frontieres[0];
+  Couples * suivante = &frontieres[1];
+
+  for( int i = 0; i < a1->nb_etats; i++ ){
+    for( int j = 0; est_marque( a1->initiaux, i ) && j < a2->nb_etats; j++ ){
+      if( est_marque( a2->initiaux, j ) ){
+	ajouter_couple( courante, i, j );
+      }
+    }
+  }
+  for( const char * p = mot; *p && nb_couples( courante ); p++ ){
+    int c1 = a1->classe[ (uint8_t) *p ];
+    int c2 = a2->classe[ (uint8_t) *p ];
+    vider_couples( suivante );
+    for( size_t k = 0; k < nb_couples( courante ); k++ ){
+      int i, j;
+      get_couple( courante, k, &i, &j );
+      if( c1 >= 0 ){
+	const int * debut = a1->debuts + (size_t) i * a1->nb_classes + c1;
+	for( int t = debut[0]; t < debut[1]; t++ ){
+	  ajouter_couple( suivante, a1->fins[t], j );
 	}
-	liberer_ensemble(etats_accessibles);				   
       }
-      
-      for(
-	  it_alph2 = premier_iterateur_ensemble(alphabet_2);
-	  !iterateur_ensemble_est_vide(it_alph2);
-	  it_alph2 = iterateur_suivant_ensemble(it_alph2)){
-	etats_accessibles = delta1(automate_2, j,get_element(it_alph2));
-	for(
-	    it_access = premier_iterateur_ensemble(etats_accessibles);
-	    !iterateur_ensemble_est_vide(it_access);
-	    it_access = iterateur_suivant_ensemble(it_access)){
-	  ajouter_transition(automate_melange,nommer_etat(i,j), get_element(it_alph2), nommer_etat(i, get_element(it_access)));
+      if( c2 >= 0 ){
+	const int * debut = a2->debuts + (size_t) j * a2->nb_classes + c2;
+	for( int t = debut[0]; t < debut[1]; t++ ){
+	  ajouter_couple( suivante, i, a2->fins[t] );
 	}
-	liberer_ensemble(etats_accessibles);				   
       }
-      
-      if(est_dans_l_ensemble(initiaux_1,i) && est_dans_l_ensemble(initiaux_2,j))
-	ajouter_element(initiaux_melange, nommer_etat(i,j));
-      if(est_dans_l_ensemble(finaux_1,i) && est_dans_l_ensemble(finaux_2,j))
-	ajouter_element(finaux_melange, nommer_etat(i,j));
     }
+    Couples * tmp = courante;
+    courante = suivante;
+    suivante = tmp;
+  }
 
+  int res = 0;
+  for( size_t k = 0; k < nb_couples( courante ) && ! res; k++ ){
+    int i, j;
+    get_couple( courante, k, &i, &j );
+    res = est_marque( a1->finaux, i ) && est_marque( a2->finaux, j );
   }
-  liberer_ensemble(automate_melange->initiaux);
-  liberer_ensemble(automate_melange->finaux);
-  automate_melange->initiaux = initiaux_melange;
-  automate_melange->finaux = finaux_melange;
-  return automate_melange;
+  detruire_couples( &frontieres[0] );
+  detruire_couples( &frontieres[1] );
+  liberer_automate_compile( a2 );
+  liberer_automate_compile( a1 );
+  return res;
+}
+
+/* La déterminisation travaille sur la forme compilée de l'automate. Les 
+ * ensembles d'états découverts sont rangés, sous forme de tableaux triés, 
+ * dans un dictionnaire de sous-ensembles : le numéro qu'il leur attribue 
+ * est leur état dans l'automate déterministe, et on les traite dans 
+ * l'ordre de ces numéros.
+ *
+ * Pour calculer un successeur, on parcourt les listes de transitions des 
+ * états de l'ensemble ; les marques (comparées à 'generation') évitent les 
+ * doublons, puis l'ensemble obtenu est trié.
+ */
+Automate * creer_automate_deterministe( const Automate* automate ){
+  Automate_compile * compile = compiler_automate( automate );
+  Automate * res = creer_automate();
+  Sous_ensembles dictionnaire;
+  initialiser_sous_ensembles( &dictionnaire );
+  int * successeurs = xmalloc( ( compile->nb_etats + 1 ) * sizeof(int) );
+  uint32_t * marques = xmalloc( ( compile->nb_etats + 1 ) * sizeof(uint32_t) );
+  memset( marques, 0, ( compile->nb_etats + 1 ) * sizeof(uint32_t) );
+  int * cibles = xmalloc( ( compile->nb_classes + 1 ) * sizeof(int) );
+  uint32_t generation = 0;
+  int i, l, k, nb;
+
+  for( l = 0; l < compile->nb_lettres; l++ ){
+    ajouter_lettre( res, compile->lettres[l] );
+  }
+
+  nb = 0;
+  for( i = 0; i < compile->nb_etats; i++ ){
+    if( ( compile->initiaux[ i / 64 ] >> ( i % 64 ) ) & 1 ){
+      successeurs[ nb++ ] = i;
+    }
+  }
+  if( nb > 0 ){
+    ajouter_sous_ensemble( &dictionnaire, successeurs, nb, NULL );
+    ajouter_etat_initial( res, 0 );
+  }
+
+  for( i = 0; i < nb_sous_ensembles( &dictionnaire ); i++ ){
+    int taille;
+    const int * etats = get_sous_ensemble( &dictionnaire, i, &taille );
+    ajouter_etat( res, i );
+    for( k = 0; k < taille; k++ ){
+      int e = etats[k];
+      if( ( compile->finaux[ e / 64 ] >> ( e % 64 ) ) & 1 ){
+	ajouter_etat_final( res, i );
+	break;
+      }
+    }
+
+    for( l = 0; l < compile->nb_classes; l++ ){
+      cibles[l] = -1;
+      if( ++generation == 0 ){
+	memset( marques, 0, compile->nb_etats * sizeof(uint32_t) );
+	generation = 1;
+      }
+      // Le dictionnaire a pu être agrandi : on reprend le pointeur.
+      etats = get_sous_ensemble( &dictionnaire, i, &taille );
+      nb = 0;
+      for( k = 0; k < taille; k++ ){
+	const int * debut = 
+	  compile->debuts + (size_t) etats[k] * compile->nb_classes + l;
+	int t;
+	for( t = debut[0]; t < debut[1]; t++ ){
+	  int fin = compile->fins[t];
+	  if( marques[fin] != generation ){
+	    marques[fin] = generation;
+	    successeurs[ nb++ ] = fin;
+	  }
+	}
+      }
+      if( nb == 0 ){
+	continue;
+      }
+      qsort( successeurs, nb, sizeof(int), comparer_entiers );
+      cibles[l] = ajouter_sous_ensemble( &dictionnaire, successeurs, nb, NULL );
+    }
+    for( l = 0; l < compile->nb_lettres; l++ ){
+      int j = cibles[ classe_lettre( compile, l ) ];
+      if( j >= 0 ){
+	ajouter_transition( res, i, compile->lettres[l], j );
+      }
+    }
+  }
+
+  xfree( successeurs );
+  xfree( marques );
+  xfree( cibles );
+  detruire_sous_ensembles( &dictionnaire );
+  liberer_automate_compile( compile );
+  return res;
+}
+
+int est_deterministe( const Automate* automate ){
+  if( taille_ensemble( get_initiaux( automate ) ) > 1 ){
+    return 0;
+  }
+  Table_iterateur it;
+  for(
+      it = premier_iterateur_table( automate->transitions );
+      ! iterateur_est_vide( it );
+      it = iterateur_suivant_table( it )
+      ){
+    if( taille_ensemble( (Ensemble*) get_valeur( it ) ) > 1 ){
+      return 0;
+    }
+  }
+  return 1;
 }
 
+/* État d'une minimisation de Hopcroft.
+ *
+ * Les états (denses, ceux de l'automate compilé, plus le puits qui porte le
+ * numéro nb_etats) sont rangés dans 'elements' de sorte que chaque bloc de
+ * la partition occupe une tranche [debut, fin) de ce tableau. Pendant un 
+ * raffinement, les états marqués d'un bloc sont déplacés au début de sa 
+ * tranche ; 'marques' compte ces états.
+ *
+ * Les prédécesseurs de l'état t par la classe de lettres l sont les 
+ * predecesseurs[k] pour debuts_inverses[t*nb_classes+l] <= k < 
+ * debuts_inverses[t*nb_classes+l+1].
+ */
+typedef struct {
+  const Automate_compile * automate;
+  int puits;
+  int * elements;
+  int * position;
+  int * bloc;
+  int nb_blocs;
+  int * debut;
+  int * fin;
+  int * marques;
+  int * attente;
+  int nb_attente;
+  char * en_attente;
+  int * debuts_inverses;
+  int * predecesseurs;
+} Minimisation;
+
+/* Successeur d'un état dense dans l'automate complété par le puits. */
+static int successeur_complet(
+    const Minimisation * m, int etat, int lettre
+){
+  const Automate_compile * a = m->automate;
+  if( etat == m->puits ){
+    return m->puits;
+  }
+  const int * debut = a->debuts + (size_t) etat * a->nb_classes + lettre;
+  return debut[0] < debut[1] ? a->fins[ debut[0] ] : m->puits;
+}
+
+static int est_final_compile( const Automate_compile * a, int etat ){
+  return ( a->finaux[ etat / 64 ] >> ( etat % 64 ) ) & 1;
+}
+
+static void mettre_en_attente( Minimisation * m, int b ){
+  if( ! m->en_attente[b] ){
+    m->en_attente[b] = 1;
+    m->attente[ m->nb_attente++ ] = b;
+  }
+}
+
+static int nouveau_bloc( Minimisation * m, int debut, int fin ){
+  int b = m->nb_blocs++;
+  m->debut[b] = debut;
+  m->fin[b] = fin;
+  m->marques[b] = 0;
+  m->en_attente[b] = 0;
+  for( int i = debut; i < fin; i++ ){
+    m->bloc[ m->elements[i] ] = b;
+  }
+  return b;
+}
+
+static void marquer( Minimisation * m, int etat, int * touches, int * nb_touches ){
+  int b = m->bloc[etat];
+  if( m->marques[b] == 0 ){
+    touches[ (*nb_touches)++ ] = b;
+  }
+  int i = m->debut[b] + m->marques[b]++;
+  int autre = m->elements[i];
+  int j = m->position[etat];
+  m->elements[i] = etat;
+  m->position[etat] = i;
+  m->elements[j] = autre;
+  m->position[autre] = j;
+}
+
+/* Coupe chaque bloc touché entre ses états marqués et les autres. Le 
+ * nouveau bloc reçoit les états marqués. Si le bloc coupé était en 
+ * attente, les deux moitiés doivent l'être ; sinon, il suffit d'attendre 
+ * la plus petite.
+ */
+static void couper_blocs( Minimisation * m, const int * touches, int nb_touches ){
+  for( int i = 0; i < nb_touches; i++ ){
+    int b = touches[i];
+    int nb_marques = m->marques[b];
+    m->marques[b] = 0;
+    if( nb_marques == m->fin[b] - m->debut[b] ){
+      continue;
+    }
+    int nouveau = nouveau_bloc( m, m->debut[b], m->debut[b] + nb_marques );
+    m->debut[b] = m->fin[nouveau];
+    if( m->en_attente[b] || 
+	m->fin[nouveau] - m->debut[nouveau] <= m->fin[b] - m->debut[b] ){
+      mettre_en_attente( m, nouveau );
+    }else{
+      mettre_en_attente( m, b );
+    }
+  }
+}
+
+/* Calcule les états accessibles depuis l'état initial (s'il existe) et les
+ * range dans 'elements' ; le puits est ajouté à la fin. Renvoie leur 
+ * nombre.
+ */
+static int ranger_etats_accessibles( Minimisation * m, int initial ){
+  const Automate_compile * a = m->automate;
+  int nb = 0;
+  for( int e = 0; e <= m->puits; e++ ){
+    m->position[e] = -1;
+  }
+  if( initial >= 0 ){
+    m->position[initial] = nb;
+    m->elements[nb++] = initial;
+  }
+  for( int i = 0; i < nb; i++ ){
+    for( int l = 0; l < a->nb_classes; l++ ){
+      int t = successeur_complet( m, m->elements[i], l );
+      if( t != m->puits && m->position[t] < 0 ){
+	m->position[t] = nb;
+	m->elements[nb++] = t;
+      }
+    }
+  }
+  m->position[ m->puits ] = nb;
+  m->elements[ nb++ ] = m->puits;
+  return nb;
+}
+
+static void construire_index_inverse( Minimisation * m, int nb ){
+  int nb_classes = m->automate->nb_classes;
+  size_t nb_listes = (size_t) ( m->puits + 1 ) * nb_classes;
+  m->debuts_inverses = xmalloc( ( nb_listes + 1 ) * sizeof(int) );
+  memset( m->debuts_inverses, 0, ( nb_listes + 1 ) * sizeof(int) );
+  m->predecesseurs = xmalloc( ( (size_t) nb * nb_classes + 1 ) * sizeof(int) );
+  for( int i = 0; i < nb; i++ ){
+    for( int l = 0; l < nb_classes; l++ ){
+      int t = successeur_complet( m, m->elements[i], l );
+      m->debuts_inverses[ (size_t) t * nb_classes + l + 1 ]++;
+    }
+  }
+  for( size_t k = 0; k < nb_listes; k++ ){
+    m->debuts_inverses[k+1] += m->debuts_inverses[k];
+  }
+  int * curseurs = xmalloc( ( nb_listes + 1 ) * sizeof(int) );
+  memcpy( curseurs, m->debuts_inverses, ( nb_listes + 1 ) * sizeof(int) );
+  for( int i = 0; i < nb; i++ ){
+    for( int l = 0; l < nb_classes; l++ ){
+      int e = m->elements[i];
+      int t = successeur_complet( m, e, l );
+      m->predecesseurs[ curseurs[ (size_t) t * nb_classes + l ]++ ] = e;
+    }
+  }
+  xfree( curseurs );
+}
+
+static void raffiner_partition( Minimisation * m, int nb ){
+  int nb_classes = m->automate->nb_classes;
+  int * separateur = xmalloc( ( nb + 1 ) * sizeof(int) );
+  int * touches = xmalloc( ( nb + 1 ) * sizeof(int) );
+
+  while( m->nb_attente > 0 ){
+    int s = m->attente[ --m->nb_attente ];
+    m->en_attente[s] = 0;
+    // Le bloc s peut être coupé pendant qu'on s'en sert : on en garde une 
+    // copie.
+    int taille = m->fin[s] - m->debut[s];
+    memcpy( separateur, m->elements + m->debut[s], taille * sizeof(int) );
+    for( int l = 0; l < nb_classes; l++ ){
+      int nb_touches = 0;
+      for( int i = 0; i < taille; i++ ){
+	size_t liste = (size_t) separateur[i] * nb_classes + l;
+	for( int k = m->debuts_inverses[liste]; k < m->debuts_inverses[liste+1]; k++ ){
+	  marquer( m, m->predecesseurs[k], touches, &nb_touches );
+	}
+      }
+      couper_blocs( m, touches, nb_touches );
+    }
+  }
+
+  xfree( separateur );
+  xfree( touches );
+}
+
+Automate * creer_automate_minimal(
+    const Automate* automate, Table* correspondance
+){
+  if( ! est_deterministe( automate ) ){
+    ERREUR( "L'automate à minimiser doit être déterministe" );
+  }
+  Automate_compile * a = compiler_automate( automate );
+  Minimisation m;
+  int n = a->nb_etats + 1;
+  int initial = -1;
+  int e, i, l;
+
+  for( e = 0; e < a->nb_etats; e++ ){
+    if( ( a->initiaux[ e / 64 ] >> ( e % 64 ) ) & 1 ){
+      initial = e;
+    }
+  }
+
+  m.automate = a;
+  m.puits = a->nb_etats;
+  m.elements = xmalloc( n * sizeof(int) );
+  m.position = xmalloc( n * sizeof(int) );
+  m.bloc = xmalloc( n * sizeof(int) );
+  m.debut = xmalloc( n * sizeof(int) );
+  m.fin = xmalloc( n * sizeof(int) );
+  m.marques = xmalloc( n * sizeof(int) );
+  m.attente = xmalloc( n * sizeof(int) );
+  m.en_attente = xmalloc( n );
+  m.nb_blocs = 0;
+  m.nb_attente = 0;
+
+  int nb = ranger_etats_accessibles( &m, initial );
+  construire_index_inverse( &m, nb );
+
+  // Partition initiale : les états finaux d'abord, puis les autres.
+  int nb_finaux = 0;
+  for( i = 0; i < nb; i++ ){
+    e = m.elements[i];
+    if( e != m.puits && est_final_compile( a, e ) ){
+      m.elements[i] = m.elements[nb_finaux];
+      m.position[ m.elements[i] ] = i;
+      m.elements[nb_finaux] = e;
+      m.position[e] = nb_finaux++;
+    }
+  }
+  if( nb_finaux > 0 ){
+    int finaux = nouveau_bloc( &m, 0, nb_finaux );
+    int autres = nouveau_bloc( &m, nb_finaux, nb );
+    mettre_en_attente( &m, nb_finaux <= nb - nb_finaux ? finaux : autres );
+    raffiner_partition( &m, nb );
+  }else{
+    nouveau_bloc( &m, 0, nb );
+  }
+
+  // Numérotation des blocs par un parcours en largeur depuis l'état 
+  // initial. Le bloc du puits est abandonné.
+  Automate * res = creer_automate();
+  for( l = 0; l < a->nb_lettres; l++ ){
+    ajouter_lettre( res, a->lettres[l] );
+  }
+  int bloc_puits = m.bloc[ m.puits ];
+  int * numero = m.attente;
+  int * file = m.marques;
+  int nb_numeros = 0;
+  for( i = 0; i < m.nb_blocs; i++ ){
+    numero[i] = -1;
+  }
+  if( initial >= 0 && m.bloc[initial] != bloc_puits ){
+    numero[ m.bloc[initial] ] = nb_numeros;
+    file[ nb_numeros++ ] = m.bloc[initial];
+    ajouter_etat_initial( res, 0 );
+  }
+  for( i = 0; i < nb_numeros; i++ ){
+    int b = file[i];
+    int representant = m.elements[ m.debut[b] ];
+    if( est_final_compile( a, representant ) ){
+      ajouter_etat_final( res, i );
+    }
+    for( l = 0; l < a->nb_lettres; l++ ){
+      int t = m.bloc[ 
+        successeur_complet( &m, representant, classe_lettre( a, l ) ) 
+      ];
+      if( t == bloc_puits ){
+	continue;
+      }
+      if( numero[t] < 0 ){
+	numero[t] = nb_numeros;
+	file[ nb_numeros++ ] = t;
+      }
+      ajouter_transition( res, i, a->lettres[l], numero[t] );
+    }
+  }
+
+  if( correspondance ){
+    for( i = 0; i < nb; i++ ){
+      e = m.elements[i];
+      if( e != m.puits && numero[ m.bloc[e] ] >= 0 ){
+	add_table( correspondance, a->etats[e], numero[ m.bloc[e] ] );
+      }
+    }
+  }
+
+  xfree( m.elements );
+  xfree( m.position );
+  xfree( m.bloc );
+  xfree( m.debut );
+  xfree( m.fin );
+  xfree( m.marques );
+  xfree( m.attente );
+  xfree( m.en_attente );
+  xfree( m.debuts_inverses );
+  xfree( m.predecesseurs );
+  liberer_automate_compile( a );
+  return res;
+}
 
+/* Les états de l'automate complété sont les indices des états compilés, 
+ * c'est-à-dire leurs rangs dans l'ordre croissant ; le puits, s'il est 
+ * nécessaire, est l'état n. Il l'est s'il manque une transition, ou s'il
+ * n'y a pas d'état initial : le puits devient alors initial.
+ */
+Automate * completer_automate( const Automate * automate ){
+  Automate_compile * a = compiler_automate( automate );
+  Automate * res = creer_automate();
+  ajouter_elements( res->alphabet, get_alphabet( automate ) );
+  int puits = a->nb_etats;
+  int avec_puits = 1;
+  for( int e = 0; e < a->nb_etats; e++ ){
+    ajouter_etat( res, e );
+    if( est_marque( a->initiaux, e ) ){
+      ajouter_etat_initial( res, e );
+      avec_puits = 0;
+    }
+    if( est_marque( a->finaux, e ) ){
+      ajouter_etat_final( res, e );
+    }
+  }
+  for( int e = 0; e < a->nb_etats; e++ ){
+    for( int l = 0; l < a->nb_lettres; l++ ){
+      const int * debut = 
+	a->debuts + (size_t) e * a->nb_classes + classe_lettre( a, l );
+      if( debut[0] == debut[1] ){
+	ajouter_transition( res, e, a->lettres[l], puits );
+	avec_puits = 1;
+      }
+      for( int k = debut[0]; k < debut[1]; k++ ){
+	ajouter_transition( res, e, a->lettres[l], a->fins[k] );
+      }
+    }
+  }
+  if( avec_puits ){
+    ajouter_etat( res, puits );
+    if( taille_ensemble( get_initiaux( res ) ) == 0 ){
+      ajouter_etat_initial( res, puits );
+    }
+    for( int l = 0; l < a->nb_lettres; l++ ){
+      ajouter_transition( res, puits, a->lettres[l], puits );
+    }
+  }
+  liberer_automate_compile( a );
+  return res;
+}
 
+/* Sur un automate déterministe complet, il suffit d'échanger les états 
+ * finaux et les autres.
+ */
+Automate * complementer_automate( const Automate * automate ){
+  Automate * res;
+  if( est_deterministe( automate ) ){
+    res = completer_automate( automate );
+  }else{
+    Automate * deterministe = creer_automate_deterministe( automate );
+    res = completer_automate( deterministe );
+    liberer_automate( deterministe );
+  }
+  Ensemble * finaux = creer_difference_ensemble( 
+    get_etats( res ), get_finaux( res ) 
+  );
+  liberer_ensemble( res->finaux );
+  res->finaux = finaux;
+  return res;
+}
 
-  
+/* L'intersection est la partie accessible du produit PRODUIT_INTERSECTION,
+ * construite par le même parcours que le mélange.
+ */
+Automate * creer_intersection_des_automates(
+  const Automate * automate_1, const Automate * automate_2
+){
+  Produit * produit = 
+    creer_produit( automate_1, automate_2, PRODUIT_INTERSECTION );
+  Automate * res = construire_produit( produit );
+  liberer_produit( produit );
+  return res;
+}
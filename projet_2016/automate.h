@@ -23,6 +23,9 @@
 #ifndef __AUTOMATE_H__
 #define __AUTOMATE_H__
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include "ensemble.h"
 
 /**
@@ -34,6 +37,9 @@
  * pas d'epsilon transition.
  * L'automate codé peut avoir plusieurs états initiaux.
  * 
+ * Si le champ arena n'est pas NULL, tous les ensembles, la table des 
+ * transitions et ses clés sont alloués dans ce pool (voir 
+ * creer_automate_arena()).
  */
 
 struct Automate {
@@ -41,8 +47,10 @@ struct Automate {
 	Ensemble * etats;
 	Ensemble * alphabet;
 	Table* transitions;
+	Table* transitions_inverses; //!< NULL tant que indexer_antecedents() n'a pas été appelée.
 	Ensemble * initiaux;
 	Ensemble * finaux;
+	Pool * arena;
 };
 
 typedef struct Automate Automate;
@@ -59,6 +67,27 @@ typedef struct Cle {
  */
 Automate * creer_automate();
 
+/**
+ * @brief Crée un automate vide dont toutes les structures sont allouées dans
+ *        une même zone mémoire.
+ *
+ * L'automate s'utilise exactement comme un automate créé par 
+ * creer_automate(). Par contre, liberer_automate() et vider_automate() ne 
+ * parcourent pas ses états et ses transitions : ils rendent la zone mémoire
+ * en bloc, avec un free() par tronçon de la zone (dont la taille double à 
+ * chaque tronçon) au lieu d'un free() par noeud.
+ *
+ * C'est le bon choix pour les automates temporaires, construits puis jetés
+ * aussitôt.
+ *
+ * Les ensembles d'un tel automate ne doivent pas être échangés avec
+ * swap_ensemble() ou deplacer_ensemble() contre des ensembles alloués 
+ * normalement.
+ *
+ * @return L'automate créé.
+ */
+Automate * creer_automate_arena();
+
 /**
  * @brief Détruit un automate.
  * 
@@ -66,6 +95,16 @@ Automate * creer_automate();
  */ 
 void liberer_automate( Automate * automate);
 
+/**
+ * @brief Retire tous les états, les lettres et les transitions d'un automate.
+ *
+ * L'automate est alors identique à un automate qui vient d'être créé, et 
+ * garde son mode d'allocation.
+ *
+ * @param automate L'automate à vider.
+ */
+void vider_automate( Automate * automate );
+
 /**
  * @brief Ajoute un état à un automate passé en paramètre.
  *
@@ -97,6 +136,36 @@ void ajouter_transition(
 	Automate * automate, int origine, char lettre, int fin
 );
 
+/**
+ * @brief Construit l'index inverse des transitions de l'automate.
+ *
+ * L'index associe à chaque couple (fin, lettre) l'ensemble des origines des
+ * transitions correspondantes. Une fois construit, il est tenu à jour par 
+ * ajouter_transition() et vider_automate(), et antecedents() devient 
+ * utilisable. L'appel ne fait rien si l'index existe déjà.
+ *
+ * @param automate Un automate.
+ */
+void indexer_antecedents( Automate * automate );
+
+/**
+ * @brief Renvoie l'ensemble des origines des transitions étiquetées par
+ *        'lettre' qui arrivent en 'fin'.
+ *
+ * L'index inverse doit avoir été construit (voir indexer_antecedents()), 
+ * sinon le programme s'arrête avec une erreur. La recherche coûte 
+ * O(log n) où n est le nombre de couples (fin, lettre) de l'index.
+ *
+ * La mémoire de l'ensemble renvoyé est gérée par l'automate.
+ * L'utilisateur ne doit donc pas modifier ou libérer l'ensemble ainsi obtenu.
+ *
+ * @param automate Un automate.
+ * @param fin La fin des transitions.
+ * @param lettre La lettre des transitions.
+ * @return L'ensemble des origines.
+ */
+const Ensemble * antecedents( const Automate* automate, int fin, char lettre );
+
 /**
  * @brief Ajoute un état final à un automate passé en paramètre.
  *
@@ -234,6 +303,20 @@ Ensemble * delta1(
 	const Automate* automate, int origine, char lettre
 );
 
+/**
+ * @brief Renvoie l'ensemble des fins des transitions partant de 'origine' 
+ *        et étiquetées par 'lettre', sans le copier (voir delta1()).
+ *
+ * La mémoire de l'ensemble renvoyé est gérée par l'automate.
+ * L'utilisateur ne doit donc pas modifier ou libérer l'ensemble ainsi obtenu.
+ *
+ * @param automate Un automate.
+ * @param origine Un état.
+ * @param lettre Une lettre.
+ * @return L'ensemble des fins.
+ */ 
+const Ensemble * voisins( const Automate* automate, int origine, char lettre );
+
 /**
  * @brief Renvoie l'ensemble des états accéssibles à partir d'un ensemble 
  *        d'états donné en paramètre et en lisant une lettre donnée en 
@@ -280,6 +363,37 @@ Ensemble * delta_star(
  */ 
 int le_mot_est_reconnu( const Automate* automate, const char* mot );
 
+/**
+ * @brief Équivalent de delta_star() pour un mot donné par ses octets et sa
+ *        longueur.
+ *
+ * Le mot peut contenir n'importe quel octet, y compris 0 : l'octet o est lu
+ * comme la lettre (char) o.
+ *
+ * @param automate Un automate.
+ * @param etats_courants L'ensemble des état origines.
+ * @param mot Les lettres du mot.
+ * @param taille Le nombre de lettres du mot.
+ * @return L'ensemble des états accessibles, à libérer par l'utilisateur.
+ */ 
+Ensemble * delta_star_octets(
+	const Automate* automate, const Ensemble * etats_courants, 
+	const uint8_t* mot, size_t taille
+);
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu() pour un mot donné par ses 
+ *        octets et sa longueur (voir delta_star_octets()).
+ *
+ * @param automate Un automate.
+ * @param mot Les lettres du mot.
+ * @param taille Le nombre de lettres du mot.
+ * @return 1 ou 0
+ */ 
+int le_mot_est_reconnu_octets( 
+	const Automate* automate, const uint8_t* mot, size_t taille 
+);
+
 /**
  * @brief La fonction passe en revue toutes les transitions de l'automate et 
  *        appelle la fonction passée en paramètre.
@@ -394,6 +508,54 @@ Ensemble* accessibles( const Automate * automate );
  */ 
 Automate *automate_accessible( const Automate * automate );
 
+/**
+ * @brief Renvoie l'ensemble des états co-accessibles, c'est-à-dire des états
+ *        depuis lesquels on peut atteindre un état final.
+ *
+ * Le calcul se fait en temps linéaire, par un parcours du graphe inverse 
+ * des transitions.
+ *
+ * @param automate Un automate.
+ * @return L'ensemble des états co-accessibles, à libérer par l'utilisateur.
+ */ 
+Ensemble* coaccessibles( const Automate * automate );
+
+/**
+ * @brief Renvoie l'automate émondé : seuls restent les états à la fois 
+ *        accessibles et co-accessibles, et les transitions entre ces états.
+ *
+ * L'automate émondé reconnaît le même langage et garde le même alphabet.
+ *
+ * @param automate Un automate.
+ * @return L'automate émondé, à libérer par l'utilisateur.
+ */ 
+Automate *automate_emonde( const Automate * automate );
+
+/**
+ * @brief Renvoie 1 si l'automate ne reconnaît aucun mot, 0 sinon.
+ *
+ * Le calcul se fait par un parcours en largeur depuis les états initiaux, 
+ * sur la table des transitions, qui s'arrête au premier état final 
+ * atteint : seules sont lues les transitions qui partent des états 
+ * atteints avant lui.
+ *
+ * @param automate Un automate.
+ * @return 1 ou 0
+ */
+int langage_est_vide( const Automate * automate );
+
+/**
+ * @brief Renvoie un plus court mot reconnu par l'automate, ou NULL si 
+ *        l'automate ne reconnaît aucun mot.
+ *
+ * Même parcours que langage_est_vide(), qui garde pour chaque état l'arc
+ * par lequel il a été atteint.
+ *
+ * @param automate Un automate.
+ * @return Le mot, à libérer par l'utilisateur, ou NULL.
+ */
+char * plus_court_mot_reconnu( const Automate * automate );
+
 /**
   * @brief @todo Crée l'automate du mélange.
   * 
@@ -414,6 +576,24 @@ Automate *automate_accessible( const Automate * automate );
   */
 Automate * creer_automate_du_melange( const Automate* automate1,  const Automate* automate2 );
 
+/**
+ * @brief Renvoie 1 si le mot est dans le mélange des langages reconnus par 
+ *        les deux automates, et 0 sinon.
+ *
+ * Le résultat est celui de le_mot_est_reconnu() sur l'automate du mélange 
+ * (voir creer_automate_du_melange()), mais l'automate du mélange n'est pas
+ * construit : on ne garde, à chaque position du mot, que les couples 
+ * d'états atteints. La lecture s'arrête dès qu'il n'y en a plus.
+ *
+ * @param automate_1 Le premier automate.
+ * @param automate_2 Le deuxième automate.
+ * @param mot Le mot.
+ * @return 1 ou 0
+ */
+int le_mot_est_dans_le_melange(
+	const Automate* automate_1, const Automate* automate_2, const char* mot
+);
+
 /**
  * @brief Affiche sur l'entrée standard (stdout) l'automate passé en paramètre.
  *
@@ -442,11 +622,135 @@ Automate * creer_union_des_automates(
  * @brief @todo Renvoie l'automate miroir d'un automate.
  *
  * Il s'agit de l'automate qui reconnaît les mots renversés du langage associé
- * à l'automate passé en paramètre.
+ * à l'automate passé en paramètre. Si l'automate a un index inverse (voir 
+ * indexer_antecedents()), les ensembles d'origines de l'index sont copiés 
+ * tels quels au lieu d'ajouter les transitions une à une.
  *
  * @param automate Un automate.
  * @return L'automate miroir.
  */ 
 Automate *miroir( const Automate * automate);
 
+/**
+ * @brief Remplace un automate par son automate miroir.
+ *
+ * Les états initiaux et finaux sont échangés, ainsi que la table des 
+ * transitions et l'index inverse, qui est construit s'il n'existe pas 
+ * encore (voir indexer_antecedents()). Si l'index existe déjà, l'opération
+ * est en temps constant.
+ *
+ * @param automate Un automate.
+ */ 
+void miroir_en_place( Automate * automate );
+
+/**
+ * @brief Renvoie l'automate déterministe.
+ *
+ * L'automate est déterminisé par la construction des sous-ensembles. Ses 
+ * états sont numérotés de 0 à n-1 dans l'ordre où les ensembles d'états 
+ * correspondants sont découverts par un parcours en largeur : 0 est l'état
+ * initial (s'il existe). Seuls les ensembles accessibles et non vides 
+ * deviennent des états, l'automate renvoyé n'est donc pas forcément 
+ * complet. Son alphabet est celui de l'automate passé en paramètre.
+ *
+ * @param automate L'automate à déterminiser.
+ * @return L'automate déterministe correspondant.
+ */
+Automate * creer_automate_deterministe( const Automate* automate );
+
+/**
+ * @brief Renvoie 1 si l'automate est déterministe, 0 sinon.
+ *
+ * Un automate est déterministe s'il a au plus un état initial et si, pour 
+ * tout état et toute lettre, il existe au plus une transition. L'automate 
+ * n'a pas besoin d'être complet.
+ *
+ * @param automate Un automate.
+ * @return 1 ou 0
+ */
+int est_deterministe( const Automate* automate );
+
+/**
+ * @brief Renvoie l'automate minimal d'un automate déterministe.
+ *
+ * L'automate est minimisé par l'algorithme de Hopcroft, en 
+ * O(n.|A|.log n) où n est le nombre d'états et A l'alphabet. Les 
+ * transitions manquantes vont vers un état puits implicite. Les états 
+ * inaccessibles et ceux qui ne mènent à aucun état final (ceux qui sont 
+ * équivalents au puits) n'apparaissent pas dans l'automate renvoyé.
+ *
+ * Les états de l'automate minimal sont numérotés de 0 à m-1 dans l'ordre 
+ * d'un parcours en largeur depuis l'état initial (l'état 0).
+ *
+ * Si 'correspondance' n'est pas NULL, c'est une table d'entiers (créée avec
+ * des fonctions NULL) dans laquelle la fonction associe à chaque état 
+ * conservé de l'automate passé en paramètre son état dans l'automate 
+ * minimal. Les états supprimés n'y figurent pas.
+ *
+ * L'automate passé en paramètre doit être déterministe (voir 
+ * est_deterministe()), sinon le programme s'arrête avec une erreur.
+ *
+ * @param automate Un automate déterministe.
+ * @param correspondance Une table, ou NULL.
+ * @return L'automate minimal.
+ */
+Automate * creer_automate_minimal(
+	const Automate* automate, Table* correspondance
+);
+
+/**
+ * @brief Renvoie une copie complète de l'automate.
+ *
+ * Un automate est complet si, pour tout état et toute lettre de son 
+ * alphabet, il existe au moins une transition. Les transitions manquantes 
+ * sont dirigées vers un nouvel état puits, non final, qui boucle sur toutes
+ * les lettres. Si l'automate n'a pas d'état initial, le puits devient 
+ * initial. L'automate renvoyé reconnaît le même langage.
+ *
+ * Les états de l'automate renvoyé sont numérotés de 0 à n-1 dans l'ordre 
+ * croissant des états de l'automate passé en paramètre ; le puits, s'il a 
+ * été ajouté, est l'état n.
+ *
+ * @param automate Un automate.
+ * @return L'automate complet, à libérer par l'utilisateur.
+ */
+Automate * completer_automate( const Automate * automate );
+
+/**
+ * @brief Renvoie un automate déterministe et complet qui reconnaît le 
+ *        complémentaire du langage de l'automate.
+ *
+ * Le complémentaire est pris dans l'ensemble des mots sur l'alphabet de 
+ * l'automate. Pour calculer la différence L(A) \ L(B) comme l'intersection
+ * de A et du complémentaire de B, l'alphabet de B doit donc contenir celui
+ * de A (voir ajouter_lettre()).
+ *
+ * L'automate est déterminisé s'il ne l'est pas (voir 
+ * creer_automate_deterministe()), puis complété (voir completer_automate()) :
+ * ses états sont numérotés de 0 à n-1.
+ *
+ * @param automate Un automate.
+ * @return L'automate du complémentaire, à libérer par l'utilisateur.
+ */
+Automate * complementer_automate( const Automate * automate );
+
+/**
+ * @brief Crée l'intersection des automates.
+ *
+ * Cet automate reconnaît tous les mots qui sont reconnus par les deux 
+ * automates passés en paramètre. C'est leur produit, dont seuls les couples
+ * d'états accessibles depuis les couples d'états initiaux sont construits.
+ * Ses états sont numérotés de 0 à n-1 dans l'ordre d'un parcours en 
+ * largeur, et son alphabet est l'intersection des deux alphabets.
+ *
+ * Pour interroger le produit sans le construire, voir produit.h.
+ *
+ * @param automate_1 Le premier automate.
+ * @param automate_2 Le deuxième automate.
+ * @return L'automate intersection, à libérer par l'utilisateur.
+ */
+Automate * creer_intersection_des_automates(
+	const Automate * automate_1, const Automate * automate_2
+);
+
 #endif
@@ -0,0 +1,942 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _GNU_SOURCE
+
+#include "automate_compile.h"
+#include "outils.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define BITS_PAR_MOT 64
+
+static void ajouter_bit( uint64_t * mots, int i ){
+	mots[ i / BITS_PAR_MOT ] |= (uint64_t) 1 << ( i % BITS_PAR_MOT );
+}
+
+static int classe_compile( const Automate_compile * automate, uint8_t lettre ){
+	return automate->classe[ lettre ];
+}
+
+/*
+ * Indice, dans 'debuts', de la liste des fins des transitions d'origine 
+ * dense 'etat' et de classe 'classe'.
+ */
+static size_t indice_liste( 
+	const Automate_compile * automate, int etat, int classe
+){
+	return (size_t) etat * automate->nb_classes + classe;
+}
+
+static void action_tableau_etats( const intptr_t element, void* data ){
+	int ** fin = (int **) data;
+	*( (*fin)++ ) = element;
+}
+
+static void action_ajouter_lettre_compile( const intptr_t element, void* data ){
+	Automate_compile * res = (Automate_compile *) data;
+	res->indice_lettre[ (unsigned char) element ] = res->nb_lettres;
+	res->classe[ (unsigned char) element ] = res->nb_lettres;
+	res->lettres[ res->nb_lettres++ ] = (char) element;
+}
+
+static void action_compter_transition( 
+	int origine, char lettre, int fin, void* data
+){
+	Automate_compile * res = (Automate_compile *) data;
+	size_t i = indice_liste(
+		res, indice_etat_compile( res, origine ), 
+		classe_compile( res, (uint8_t) lettre )
+	);
+	res->debuts[ i+1 ]++;
+}
+
+typedef struct {
+	Automate_compile * res;
+	int * curseurs;
+} data_ranger_transition_t;
+
+static void action_ranger_transition( 
+	int origine, char lettre, int fin, void* data
+){
+	data_ranger_transition_t * info = (data_ranger_transition_t *) data;
+	size_t i = indice_liste(
+		info->res, indice_etat_compile( info->res, origine ), 
+		classe_compile( info->res, (uint8_t) lettre )
+	);
+	info->res->fins[ info->curseurs[i]++ ] = 
+		indice_etat_compile( info->res, fin );
+}
+
+typedef struct {
+	const Automate_compile * automate;
+	uint64_t * mots;
+} data_bits_t;
+
+static void action_ajouter_bit( const intptr_t element, void* data ){
+	data_bits_t * info = (data_bits_t *) data;
+	int e = indice_etat_compile( info->automate, element );
+	if( e >= 0 ){
+		ajouter_bit( info->mots, e );
+	}
+}
+
+static void bits_depuis_ensemble(
+	const Automate_compile * automate, const Ensemble * ensemble,
+	uint64_t * mots
+){
+	data_bits_t data;
+	data.automate = automate;
+	data.mots = mots;
+	memset( mots, 0, automate->nb_mots * sizeof(uint64_t) );
+	pour_tout_element( ensemble, action_ajouter_bit, &data );
+}
+
+static uint64_t * allouer_masques( size_t nb_mots ){
+	uint64_t * res = (uint64_t *) xmalloc( ( nb_mots + 1 ) * sizeof(uint64_t) );
+	memset( res, 0, ( nb_mots + 1 ) * sizeof(uint64_t) );
+	return res;
+}
+
+/*
+ * Range les transitions sous forme de masques de bits, si l'automate est 
+ * assez petit (voir automate_compile.h).
+ */
+static void construire_masques( Automate_compile * res ){
+	int e, l, k;
+	int decalage = 1;
+	res->boucles = NULL;
+	res->avances = NULL;
+	res->masques = NULL;
+	if( res->nb_etats > NB_ETATS_PARALLELES ){
+		return;
+	}
+	for( e = 0; e < res->nb_etats && decalage; e++ ){
+		const int * debut = res->debuts + indice_liste( res, e, 0 );
+		for( k = debut[0]; k < debut[res->nb_classes]; k++ ){
+			if( res->fins[k] != e && res->fins[k] != e + 1 ){
+				decalage = 0;
+				break;
+			}
+		}
+	}
+
+	size_t nb_mots = (size_t) res->nb_classes * res->nb_mots;
+	if( decalage ){
+		res->boucles = allouer_masques( nb_mots );
+		res->avances = allouer_masques( nb_mots );
+	}else{
+		res->masques = allouer_masques( res->nb_etats * nb_mots );
+	}
+	for( e = 0; e < res->nb_etats; e++ ){
+		for( l = 0; l < res->nb_classes; l++ ){
+			const int * debut = res->debuts + indice_liste( res, e, l );
+			for( k = debut[0]; k < debut[1]; k++ ){
+				int fin = res->fins[k];
+				if( res->masques ){
+					ajouter_bit( 
+						res->masques + indice_liste( res, e, l ) * res->nb_mots, 
+						fin 
+					);
+				}else if( fin == e ){
+					ajouter_bit( res->boucles + (size_t) l * res->nb_mots, e );
+				}else{
+					ajouter_bit( res->avances + (size_t) l * res->nb_mots, e );
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Version de delta_bits_compile() pour les automates dont les transitions 
+ * sont rangées sous forme de masques, sur une classe de lettres.
+ * Renvoie un mot non nul si et seulement si 'res' n'est pas vide.
+ */
+static uint64_t avancer_bits(
+	const Automate_compile * automate, const uint64_t * etats, int l, 
+	uint64_t * res
+){
+	int nb_mots = automate->nb_mots;
+	uint64_t non_vide = 0;
+	if( automate->avances ){
+		const uint64_t * boucles = automate->boucles + (size_t) l * nb_mots;
+		const uint64_t * avances = automate->avances + (size_t) l * nb_mots;
+		uint64_t retenue = 0;
+		for( int i = 0; i < nb_mots; i++ ){
+			uint64_t avance = etats[i] & avances[i];
+			res[i] = ( etats[i] & boucles[i] ) | ( avance << 1 ) | retenue;
+			retenue = avance >> ( BITS_PAR_MOT - 1 );
+			non_vide |= res[i];
+		}
+		return non_vide;
+	}
+
+	memset( res, 0, nb_mots * sizeof(uint64_t) );
+	for( int i = 0; i < nb_mots; i++ ){
+		uint64_t mot = etats[i];
+		while( mot ){
+			int e = i * BITS_PAR_MOT + __builtin_ctzll( mot );
+			const uint64_t * masque = 
+				automate->masques + indice_liste( automate, e, l ) * nb_mots;
+			for( int j = 0; j < nb_mots; j++ ){
+				res[j] |= masque[j];
+			}
+			mot &= mot - 1;
+		}
+	}
+	for( int i = 0; i < nb_mots; i++ ){
+		non_vide |= res[i];
+	}
+	return non_vide;
+}
+
+static int est_parallele( const Automate_compile * automate ){
+	return automate->avances || automate->masques;
+}
+
+/*
+ * Lit les 'taille' lettres de 'mot' sur des ensembles d'états représentés 
+ * par des bits, depuis les états de 'etats'. Le résultat est écrit dans 
+ * 'etats'.
+ */
+static void lire_mot_bits(
+	const Automate_compile * automate, uint64_t * etats, const uint8_t * mot,
+	size_t taille
+){
+	const uint8_t * fin_mot = mot + taille;
+	uint64_t tampon[ NB_ETATS_PARALLELES / BITS_PAR_MOT ];
+	uint64_t * courant = etats;
+	uint64_t * suivant = tampon;
+	int nb_mots = automate->nb_mots;
+	uint64_t non_vide = 0;
+	for( int i = 0; i < nb_mots; i++ ){
+		non_vide |= etats[i];
+	}
+	for( ; mot < fin_mot && non_vide; mot++ ){
+		int l = classe_compile( automate, *mot );
+		if( l < 0 ){
+			memset( courant, 0, nb_mots * sizeof(uint64_t) );
+			break;
+		}
+		non_vide = avancer_bits( automate, courant, l, suivant );
+		uint64_t * tmp = courant;
+		courant = suivant;
+		suivant = tmp;
+	}
+	if( courant != etats ){
+		memcpy( etats, courant, nb_mots * sizeof(uint64_t) );
+	}
+}
+
+static uint64_t * allouer_mots_compile( const Automate_compile * automate ){
+	return (uint64_t *) xmalloc( 
+		( automate->nb_mots + 1 ) * sizeof(uint64_t) 
+	);
+}
+
+/*
+ * Hachage des transitions de la lettre (pour l'instant seule dans sa 
+ * classe) 'lettre' depuis tous les états.
+ */
+static uint64_t hacher_lettre( const Automate_compile * res, int lettre ){
+	uint64_t h = 14695981039346656037ULL;
+	for( int e = 0; e < res->nb_etats; e++ ){
+		const int * debut = res->debuts + indice_liste( res, e, lettre );
+		for( int k = debut[0]; k < debut[1]; k++ ){
+			h = ( h ^ (uint64_t) e ) * 1099511628211ULL;
+			h = ( h ^ (uint64_t) res->fins[k] ) * 1099511628211ULL;
+		}
+	}
+	return h;
+}
+
+static int memes_transitions( const Automate_compile * res, int l1, int l2 ){
+	for( int e = 0; e < res->nb_etats; e++ ){
+		const int * d1 = res->debuts + indice_liste( res, e, l1 );
+		const int * d2 = res->debuts + indice_liste( res, e, l2 );
+		if( 
+			d1[1] - d1[0] != d2[1] - d2[0] ||
+			memcmp( res->fins + d1[0], res->fins + d2[0], 
+				( d1[1] - d1[0] ) * sizeof(int) )
+		){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Regroupe en une classe les lettres qui ont les mêmes transitions depuis 
+ * tous les états, et ne garde qu'une liste de fins par état et par classe.
+ * Au départ, chaque lettre est seule dans sa classe.
+ */
+static void regrouper_lettres( Automate_compile * res ){
+	int nb_lettres = res->nb_lettres;
+	uint64_t * hachages = 
+		(uint64_t *) xmalloc( ( nb_lettres + 1 ) * sizeof(uint64_t) );
+	int * representants = (int *) xmalloc( ( nb_lettres + 1 ) * sizeof(int) );
+	int * classes = (int *) xmalloc( ( nb_lettres + 1 ) * sizeof(int) );
+	int nb_classes = 0;
+	for( int l = 0; l < nb_lettres; l++ ){
+		hachages[l] = hacher_lettre( res, l );
+		int c;
+		for( c = 0; c < nb_classes; c++ ){
+			int r = representants[c];
+			if( hachages[r] == hachages[l] && memes_transitions( res, r, l ) ){
+				break;
+			}
+		}
+		if( c == nb_classes ){
+			representants[ nb_classes++ ] = l;
+		}
+		classes[l] = c;
+	}
+
+	if( nb_classes < nb_lettres ){
+		size_t nb_listes = (size_t) res->nb_etats * nb_classes;
+		int * debuts = (int *) xmalloc( ( nb_listes + 1 ) * sizeof(int) );
+		int * fins = (int *) xmalloc( 
+			( res->debuts[ (size_t) res->nb_etats * nb_lettres ] + 1 ) * sizeof(int) 
+		);
+		int nb_fins = 0;
+		for( int e = 0; e < res->nb_etats; e++ ){
+			for( int c = 0; c < nb_classes; c++ ){
+				const int * debut = 
+					res->debuts + indice_liste( res, e, representants[c] );
+				debuts[ (size_t) e * nb_classes + c ] = nb_fins;
+				for( int k = debut[0]; k < debut[1]; k++ ){
+					fins[ nb_fins++ ] = res->fins[k];
+				}
+			}
+		}
+		debuts[nb_listes] = nb_fins;
+		xfree( res->debuts );
+		xfree( res->fins );
+		res->debuts = debuts;
+		res->fins = fins;
+		res->nb_classes = nb_classes;
+		for( int l = 0; l < nb_lettres; l++ ){
+			res->classe[ (unsigned char) res->lettres[l] ] = classes[l];
+		}
+	}
+
+	xfree( hachages );
+	xfree( representants );
+	xfree( classes );
+}
+
+Automate_compile * compiler_automate( const Automate * automate ){
+	Automate_compile * res = 
+		(Automate_compile *) xmalloc( sizeof(Automate_compile) );
+
+	// Les états, triés par ordre croissant.
+	res->nb_etats = taille_ensemble( get_etats( automate ) );
+	res->nb_mots = ( res->nb_etats + BITS_PAR_MOT - 1 ) / BITS_PAR_MOT;
+	res->etats = (int *) xmalloc( ( res->nb_etats + 1 ) * sizeof(int) );
+	int * fin = res->etats;
+	pour_tout_element( get_etats( automate ), action_tableau_etats, &fin );
+
+	// Les lettres.
+	res->nb_lettres = 0;
+	res->lettres = (char *) xmalloc( 
+		taille_ensemble( get_alphabet( automate ) ) + 1 
+	);
+	for( int i = 0; i < 256; i++ ){
+		res->indice_lettre[i] = -1;
+		res->classe[i] = -1;
+	}
+	pour_tout_element( 
+		get_alphabet( automate ), action_ajouter_lettre_compile, res 
+	);
+	res->nb_classes = res->nb_lettres;
+
+	// Les transitions, d'abord avec une classe par lettre : on compte les 
+	// fins de chaque liste, puis on les range.
+	size_t nb_listes = (size_t) res->nb_etats * res->nb_classes;
+	res->debuts = (int *) xmalloc( ( nb_listes + 1 ) * sizeof(int) );
+	memset( res->debuts, 0, ( nb_listes + 1 ) * sizeof(int) );
+	pour_toute_transition( automate, action_compter_transition, res );
+	for( size_t i = 0; i < nb_listes; i++ ){
+		res->debuts[i+1] += res->debuts[i];
+	}
+	res->fins = (int *) xmalloc( ( res->debuts[nb_listes] + 1 ) * sizeof(int) );
+	data_ranger_transition_t data;
+	data.res = res;
+	data.curseurs = (int *) xmalloc( ( nb_listes + 1 ) * sizeof(int) );
+	memcpy( data.curseurs, res->debuts, ( nb_listes + 1 ) * sizeof(int) );
+	pour_toute_transition( automate, action_ranger_transition, &data );
+	xfree( data.curseurs );
+	regrouper_lettres( res );
+
+	res->initiaux = allouer_mots_compile( res );
+	res->finaux = allouer_mots_compile( res );
+	bits_depuis_ensemble( res, get_initiaux( automate ), res->initiaux );
+	bits_depuis_ensemble( res, get_finaux( automate ), res->finaux );
+	construire_masques( res );
+	return res;
+}
+
+void liberer_automate_compile( Automate_compile * automate ){
+	if( automate ){
+		xfree( automate->etats );
+		xfree( automate->lettres );
+		xfree( automate->debuts );
+		xfree( automate->fins );
+		xfree( automate->initiaux );
+		xfree( automate->finaux );
+		xfree( automate->boucles );
+		xfree( automate->avances );
+		xfree( automate->masques );
+		xfree( automate );
+	}
+}
+
+int indice_etat_compile( const Automate_compile * automate, int etat ){
+	int debut = 0, fin = automate->nb_etats;
+	while( debut < fin ){
+		int milieu = debut + ( fin - debut ) / 2;
+		if( automate->etats[milieu] < etat ){
+			debut = milieu + 1;
+		}else{
+			fin = milieu;
+		}
+	}
+	if( debut < automate->nb_etats && automate->etats[debut] == etat ){
+		return debut;
+	}
+	return -1;
+}
+
+int delta_bits_compile(
+	const Automate_compile * automate, const uint64_t * etats, char lettre,
+	uint64_t * res
+){
+	int non_vide = 0;
+	int l = classe_compile( automate, (uint8_t) lettre );
+	if( l >= 0 && est_parallele( automate ) ){
+		return avancer_bits( automate, etats, l, res ) != 0;
+	}
+	memset( res, 0, automate->nb_mots * sizeof(uint64_t) );
+	if( l < 0 ){
+		return 0;
+	}
+	for( int i = 0; i < automate->nb_mots; i++ ){
+		uint64_t mot = etats[i];
+		while( mot ){
+			int e = i * BITS_PAR_MOT + __builtin_ctzll( mot );
+			const int * debut = automate->debuts + indice_liste( automate, e, l );
+			for( int k = debut[0]; k < debut[1]; k++ ){
+				ajouter_bit( res, automate->fins[k] );
+			}
+			non_vide |= debut[0] < debut[1];
+			mot &= mot - 1;
+		}
+	}
+	return non_vide;
+}
+
+/*
+ * Les fonctions de lecture de mots suivent les états courants dans une liste
+ * (sans doublons) plutôt que dans un tableau de bits : une étape ne coûte 
+ * que le nombre de transitions empruntées, même si l'automate a beaucoup 
+ * d'états. Les doublons sont évités grâce à un tableau de marques : l'état e
+ * est déjà dans la liste de l'étape g si marques[e] == g.
+ */
+typedef struct {
+	int * courant;
+	int * suivant;
+	uint32_t * marques;
+	uint32_t generation;
+	int nb;
+} Lecture_compile;
+
+/*
+ * Nombre d'états en dessous duquel le_mot_est_reconnu_compile() garde ses
+ * listes sur la pile.
+ */
+#define NB_ETATS_PILE 1024
+
+static void initialiser_lecture(
+	Lecture_compile * lecture, const Automate_compile * automate, void * memoire
+){
+	lecture->courant = (int *) memoire;
+	lecture->suivant = lecture->courant + automate->nb_etats;
+	lecture->marques = (uint32_t *) ( lecture->suivant + automate->nb_etats );
+	memset( lecture->marques, 0, automate->nb_etats * sizeof(uint32_t) );
+	lecture->generation = 1;
+	lecture->nb = 0;
+}
+
+static size_t taille_memoire_lecture( const Automate_compile * automate ){
+	return (size_t) automate->nb_etats * ( 2 * sizeof(int) + sizeof(uint32_t) );
+}
+
+/*
+ * Passe à la génération de marques suivante : aucun état n'est plus marqué.
+ */
+static void nouvelle_generation_lecture(
+	Lecture_compile * lecture, const Automate_compile * automate
+){
+	if( ++lecture->generation == 0 ){
+		memset( lecture->marques, 0, automate->nb_etats * sizeof(uint32_t) );
+		lecture->generation = 1;
+	}
+}
+
+static void ajouter_etat_lecture( Lecture_compile * lecture, int e ){
+	if( lecture->marques[e] != lecture->generation ){
+		lecture->marques[e] = lecture->generation;
+		lecture->courant[ lecture->nb++ ] = e;
+	}
+}
+
+static void action_ajouter_etat_lecture( const intptr_t element, void* data ){
+	void ** info = (void **) data;
+	int e = indice_etat_compile( (const Automate_compile *) info[0], element );
+	if( e >= 0 ){
+		ajouter_etat_lecture( (Lecture_compile *) info[1], e );
+	}
+}
+
+static void lecture_depuis_ensemble(
+	Lecture_compile * lecture, const Automate_compile * automate, 
+	const Ensemble * ensemble
+){
+	void * data[2] = { (void *) automate, lecture };
+	pour_tout_element( ensemble, action_ajouter_etat_lecture, data );
+}
+
+static Ensemble * ensemble_depuis_lecture(
+	const Lecture_compile * lecture, const Automate_compile * automate
+){
+	Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+	for( int i = 0; i < lecture->nb; i++ ){
+		ajouter_element( res, automate->etats[ lecture->courant[i] ] );
+	}
+	return res;
+}
+
+/*
+ * Remplace les états courants par leurs successeurs par la lettre.
+ * Renvoie le nombre de nouveaux états courants.
+ */
+static int avancer_lecture(
+	Lecture_compile * lecture, const Automate_compile * automate, 
+	uint8_t lettre
+){
+	int l = classe_compile( automate, lettre );
+	int nb = 0;
+	nouvelle_generation_lecture( lecture, automate );
+	if( l >= 0 ){
+		for( int i = 0; i < lecture->nb; i++ ){
+			const int * debut = automate->debuts + 
+				indice_liste( automate, lecture->courant[i], l );
+			for( int k = debut[0]; k < debut[1]; k++ ){
+				int fin = automate->fins[k];
+				if( lecture->marques[fin] != lecture->generation ){
+					lecture->marques[fin] = lecture->generation;
+					lecture->suivant[ nb++ ] = fin;
+				}
+			}
+		}
+	}
+	int * tmp = lecture->courant;
+	lecture->courant = lecture->suivant;
+	lecture->suivant = tmp;
+	lecture->nb = nb;
+	return nb;
+}
+
+static void lire_mot_lecture(
+	Lecture_compile * lecture, const Automate_compile * automate,
+	const uint8_t * mot, size_t taille
+){
+	const uint8_t * fin_mot = mot + taille;
+	for( ; mot < fin_mot && lecture->nb; mot++ ){
+		avancer_lecture( lecture, automate, *mot );
+	}
+}
+
+Ensemble * delta_star_octets_compile(
+	const Automate_compile * automate, const Ensemble * etats_courants,
+	const uint8_t * mot, size_t taille
+){
+	if( est_parallele( automate ) ){
+		uint64_t etats[ NB_ETATS_PARALLELES / BITS_PAR_MOT + 1 ];
+		bits_depuis_ensemble( automate, etats_courants, etats );
+		lire_mot_bits( automate, etats, mot, taille );
+		Ensemble * res = creer_ensemble( NULL, NULL, NULL );
+		for( int i = 0; i < automate->nb_etats; i++ ){
+			if( ( etats[ i / BITS_PAR_MOT ] >> ( i % BITS_PAR_MOT ) ) & 1 ){
+				ajouter_element( res, automate->etats[i] );
+			}
+		}
+		return res;
+	}
+	Lecture_compile lecture;
+	void * memoire = xmalloc( taille_memoire_lecture( automate ) + 1 );
+	initialiser_lecture( &lecture, automate, memoire );
+	lecture_depuis_ensemble( &lecture, automate, etats_courants );
+	lire_mot_lecture( &lecture, automate, mot, taille );
+	Ensemble * res = ensemble_depuis_lecture( &lecture, automate );
+	xfree( memoire );
+	return res;
+}
+
+Ensemble * delta_compile(
+	const Automate_compile * automate, const Ensemble * etats_courants,
+	char lettre
+){
+	return delta_star_octets_compile( 
+		automate, etats_courants, (const uint8_t *) &lettre, 1 
+	);
+}
+
+Ensemble * delta_star_compile(
+	const Automate_compile * automate, const Ensemble * etats_courants,
+	const char * mot
+){
+	return delta_star_octets_compile( 
+		automate, etats_courants, (const uint8_t *) mot, strlen( mot ) 
+	);
+}
+
+/*
+ * Remplace les états courants par les états initiaux.
+ */
+static void lecture_depuis_initiaux(
+	Lecture_compile * lecture, const Automate_compile * automate
+){
+	nouvelle_generation_lecture( lecture, automate );
+	lecture->nb = 0;
+	for( int i = 0; i < automate->nb_mots; i++ ){
+		uint64_t mot = automate->initiaux[i];
+		while( mot ){
+			ajouter_etat_lecture( lecture, i * BITS_PAR_MOT + __builtin_ctzll( mot ) );
+			mot &= mot - 1;
+		}
+	}
+}
+
+static int lecture_est_acceptante(
+	const Lecture_compile * lecture, const Automate_compile * automate
+){
+	for( int i = 0; i < lecture->nb; i++ ){
+		int e = lecture->courant[i];
+		if( ( automate->finaux[ e / BITS_PAR_MOT ] >> ( e % BITS_PAR_MOT ) ) & 1 ){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Lit le mot depuis les états initiaux. La lecture doit avoir été 
+ * initialisée : ses listes sont réutilisées d'un mot à l'autre.
+ */
+static int reconnaitre_lecture(
+	Lecture_compile * lecture, const Automate_compile * automate,
+	const uint8_t * mot, size_t taille
+){
+	lecture_depuis_initiaux( lecture, automate );
+	lire_mot_lecture( lecture, automate, mot, taille );
+	return lecture_est_acceptante( lecture, automate );
+}
+
+int le_mot_est_reconnu_octets_compile(
+	const Automate_compile * automate, const uint8_t * mot, size_t taille
+){
+	if( est_parallele( automate ) ){
+		uint64_t etats[ NB_ETATS_PARALLELES / BITS_PAR_MOT + 1 ];
+		int result = 0;
+		memcpy( etats, automate->initiaux, automate->nb_mots * sizeof(uint64_t) );
+		lire_mot_bits( automate, etats, mot, taille );
+		for( int i = 0; i < automate->nb_mots; i++ ){
+			result |= ( etats[i] & automate->finaux[i] ) != 0;
+		}
+		return result;
+	}
+	int pile[ NB_ETATS_PILE * 3 ];
+	void * memoire = pile;
+	if( automate->nb_etats > NB_ETATS_PILE ){
+		memoire = xmalloc( taille_memoire_lecture( automate ) );
+	}
+	Lecture_compile lecture;
+	initialiser_lecture( &lecture, automate, memoire );
+	int result = reconnaitre_lecture( &lecture, automate, mot, taille );
+	if( memoire != pile ){
+		xfree( memoire );
+	}
+	return result;
+}
+
+int le_mot_est_reconnu_compile(
+	const Automate_compile * automate, const char * mot
+){
+	return le_mot_est_reconnu_octets_compile( 
+		automate, (const uint8_t *) mot, strlen( mot ) 
+	);
+}
+
+/*
+ * Les fils d'exécution de reconnaitre_mots_compile() se partagent les mots
+ * par paquets de TAILLE_PAQUET : chacun prend le paquet suivant dès qu'il a
+ * fini le sien.
+ */
+#define TAILLE_PAQUET 256
+
+typedef struct {
+	const Automate_compile * automate;
+	const char * const * mots;
+	size_t nb_mots;
+	int * resultats;
+	atomic_size_t suivant;
+} Lot_mots;
+
+static void * reconnaitre_lot( void * data ){
+	Lot_mots * lot = (Lot_mots *) data;
+	const Automate_compile * automate = lot->automate;
+	void * memoire = NULL;
+	Lecture_compile lecture;
+	if( ! est_parallele( automate ) ){
+		memoire = xmalloc( taille_memoire_lecture( automate ) + 1 );
+		initialiser_lecture( &lecture, automate, memoire );
+	}
+	for( ;; ){
+		size_t debut = atomic_fetch_add( &lot->suivant, TAILLE_PAQUET );
+		if( debut >= lot->nb_mots ){
+			break;
+		}
+		size_t fin = debut + TAILLE_PAQUET;
+		if( fin > lot->nb_mots ){
+			fin = lot->nb_mots;
+		}
+		for( size_t i = debut; i < fin; i++ ){
+			lot->resultats[i] = memoire ?
+				reconnaitre_lecture( 
+					&lecture, automate, (const uint8_t *) lot->mots[i], 
+					strlen( lot->mots[i] ) 
+				) :
+				le_mot_est_reconnu_compile( automate, lot->mots[i] );
+		}
+	}
+	xfree( memoire );
+	return NULL;
+}
+
+void reconnaitre_mots_compile(
+	const Automate_compile * automate, const char * const * mots, size_t n,
+	int * resultats, int nb_threads
+){
+	Lot_mots lot;
+	lot.automate = automate;
+	lot.mots = mots;
+	lot.nb_mots = n;
+	lot.resultats = resultats;
+	atomic_init( &lot.suivant, 0 );
+
+	if( nb_threads <= 0 ){
+		long nb_processeurs = sysconf( _SC_NPROCESSORS_ONLN );
+		nb_threads = nb_processeurs > 0 ? (int) nb_processeurs : 1;
+	}
+	size_t nb_paquets = ( n + TAILLE_PAQUET - 1 ) / TAILLE_PAQUET;
+	if( (size_t) nb_threads > nb_paquets ){
+		nb_threads = nb_paquets > 0 ? (int) nb_paquets : 1;
+	}
+
+	// Le fil appelant travaille aussi : il ne crée que nb_threads-1 fils.
+	pthread_t * fils = 
+		(pthread_t *) xmalloc( nb_threads * sizeof(pthread_t) );
+	for( int i = 1; i < nb_threads; i++ ){
+		if( pthread_create( &fils[i], NULL, reconnaitre_lot, &lot ) ){
+			ERREUR( "Impossible de créer un fil d'exécution" );
+		}
+	}
+	reconnaitre_lot( &lot );
+	for( int i = 1; i < nb_threads; i++ ){
+		pthread_join( fils[i], NULL );
+	}
+	xfree( fils );
+}
+
+void reconnaitre_mots(
+	const Automate * automate, const char * const * mots, size_t n,
+	int * resultats, int nb_threads
+){
+	Automate_compile * compile = compiler_automate( automate );
+	reconnaitre_mots_compile( compile, mots, n, resultats, nb_threads );
+	liberer_automate_compile( compile );
+}
+
+struct Lecteur_compile {
+	const Automate_compile * automate;
+	Lecture_compile lecture;
+	void * memoire;
+	uint64_t * bits;
+};
+
+Lecteur_compile * debut_lecture_compile( const Automate_compile * automate ){
+	Lecteur_compile * res = 
+		(Lecteur_compile *) xmalloc( sizeof(Lecteur_compile) );
+	res->automate = automate;
+	res->memoire = NULL;
+	res->bits = NULL;
+	if( est_parallele( automate ) ){
+		res->bits = allouer_mots_compile( automate );
+		memcpy( 
+			res->bits, automate->initiaux, automate->nb_mots * sizeof(uint64_t) 
+		);
+	}else{
+		res->memoire = xmalloc( taille_memoire_lecture( automate ) + 1 );
+		initialiser_lecture( &res->lecture, automate, res->memoire );
+		lecture_depuis_initiaux( &res->lecture, automate );
+	}
+	return res;
+}
+
+int nourrir_lecture_compile(
+	Lecteur_compile * lecteur, const char * tampon, size_t taille
+){
+	const Automate_compile * automate = lecteur->automate;
+	if( lecteur->bits ){
+		uint64_t non_vide = 0;
+		lire_mot_bits( 
+			automate, lecteur->bits, (const uint8_t *) tampon, taille 
+		);
+		for( int i = 0; i < automate->nb_mots; i++ ){
+			non_vide |= lecteur->bits[i];
+		}
+		return non_vide != 0;
+	}
+	lire_mot_lecture( 
+		&lecteur->lecture, automate, (const uint8_t *) tampon, taille 
+	);
+	return lecteur->lecture.nb > 0;
+}
+
+int fin_lecture_compile( Lecteur_compile * lecteur ){
+	const Automate_compile * automate = lecteur->automate;
+	int result = 0;
+	if( lecteur->bits ){
+		for( int i = 0; i < automate->nb_mots; i++ ){
+			result |= ( lecteur->bits[i] & automate->finaux[i] ) != 0;
+		}
+	}else{
+		result = lecture_est_acceptante( &lecteur->lecture, automate );
+	}
+	xfree( lecteur->bits );
+	xfree( lecteur->memoire );
+	xfree( lecteur );
+	return result;
+}
+
+/*
+ * Un fichier projeté en mémoire est lu par morceaux de TAILLE_MORCEAU 
+ * octets : les pages d'un morceau lu sont rendues au système avant de 
+ * passer au suivant, pour ne pas garder tout le fichier en mémoire. Les 
+ * fichiers qui ne peuvent pas être projetés (tubes, terminaux, fichiers 
+ * ordinaires dont mmap() échoue...) sont lus par read(), par morceaux de 
+ * TAILLE_TAMPON octets ; c'est aussi le cas des fichiers ordinaires de 
+ * taille nulle, car les fichiers de /proc et de /sys annoncent une taille
+ * nulle mais ont un contenu.
+ */
+#define TAILLE_MORCEAU ( (size_t) 1 << 24 )
+#define TAILLE_TAMPON ( (size_t) 1 << 16 )
+
+static int lire_fichier_projete(
+	Lecteur_compile * lecteur, int fd, size_t taille
+){
+	char * donnees = mmap( NULL, taille, PROT_READ, MAP_PRIVATE, fd, 0 );
+	if( donnees == MAP_FAILED ){
+		return -1;
+	}
+	madvise( donnees, taille, MADV_SEQUENTIAL );
+	for( size_t debut = 0; debut < taille; debut += TAILLE_MORCEAU ){
+		size_t nb = taille - debut;
+		if( nb > TAILLE_MORCEAU ){
+			nb = TAILLE_MORCEAU;
+		}
+		int non_vide = nourrir_lecture_compile( lecteur, donnees + debut, nb );
+		madvise( donnees + debut, nb, MADV_DONTNEED );
+		if( ! non_vide ){
+			break;
+		}
+	}
+	munmap( donnees, taille );
+	return 0;
+}
+
+static int lire_fichier_flux( Lecteur_compile * lecteur, int fd ){
+	char * tampon = (char *) xmalloc( TAILLE_TAMPON );
+	int res = 0;
+	for( ;; ){
+		ssize_t nb = read( fd, tampon, TAILLE_TAMPON );
+		if( nb < 0 && errno == EINTR ){
+			continue;
+		}
+		if( nb < 0 ){
+			res = -1;
+		}
+		if( nb <= 0 || ! nourrir_lecture_compile( lecteur, tampon, nb ) ){
+			break;
+		}
+	}
+	xfree( tampon );
+	return res;
+}
+
+int le_fichier_est_reconnu_compile(
+	const Automate_compile * automate, const char * chemin
+){
+	int fd = open( chemin, O_RDONLY );
+	if( fd < 0 ){
+		return -1;
+	}
+	struct stat info;
+	int erreur = fstat( fd, &info );
+	Lecteur_compile * lecteur = debut_lecture_compile( automate );
+	if( erreur == 0 ){
+		int projete = 
+			S_ISREG( info.st_mode ) && info.st_size > 0
+			&& lire_fichier_projete( lecteur, fd, info.st_size ) == 0;
+		if( ! projete ){
+			erreur = lire_fichier_flux( lecteur, fd );
+		}
+	}
+	close( fd );
+	int result = fin_lecture_compile( lecteur );
+	return erreur ? -1 : result;
+}
+
+int le_fichier_est_reconnu( const Automate * automate, const char * chemin ){
+	Automate_compile * compile = compiler_automate( automate );
+	int result = le_fichier_est_reconnu_compile( compile, chemin );
+	liberer_automate_compile( compile );
+	return result;
+}
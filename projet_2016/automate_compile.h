@@ -0,0 +1,317 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_compile.h */ 
+
+#ifndef __AUTOMATE_COMPILE_H__
+#define __AUTOMATE_COMPILE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "automate.h"
+
+/**
+ * @brief Le type d'un automate compilé.
+ *
+ * Un automate compilé est une copie figée d'un automate, rangée dans 
+ * quelques tableaux contigus pour être parcourue très vite :
+ *   - les états sont renumérotés de 0 à nb_etats-1, dans l'ordre croissant
+ *     de leurs numéros d'origine ('etats' donne le numéro d'origine de 
+ *     chaque état) ;
+ *   - les lettres sont numérotées de 0 à nb_lettres-1 ('indice_lettre' 
+ *     donne le numéro d'une lettre, ou -1 si elle n'est pas dans 
+ *     l'alphabet) ;
+ *   - les lettres qui ont les mêmes transitions depuis tous les états sont
+ *     regroupées en classes, numérotées de 0 à nb_classes-1 ('classe' 
+ *     donne la classe de chacun des 256 octets, ou -1 s'il n'est pas dans
+ *     l'alphabet). Les transitions ne sont rangées qu'une fois par classe ;
+ *   - les fins des transitions d'origine e et de classe c sont les 
+ *     fins[k] pour debuts[e*nb_classes+c] <= k < debuts[e*nb_classes+c+1]
+ *     (représentation CSR), triées par ordre croissant ;
+ *   - les états initiaux et finaux sont des tableaux de nb_mots mots de 64 
+ *     bits, le bit e étant à 1 si l'état e est initial (resp. final).
+ *
+ * Pour les automates d'au plus NB_ETATS_PARALLELES états, les transitions 
+ * sont aussi rangées sous forme de masques de bits, pour lire une lettre en
+ * quelques opérations sur des mots machine :
+ *   - si toutes les transitions vont de e à e ou de e à e+1 (c'est le cas 
+ *     des automates reconnaissant un mot ou un facteur), 'boucles' et 
+ *     'avances' donnent, pour chaque classe l, les nb_mots mots des états e
+ *     tels que e -l-> e (resp. e -l-> e+1) est une transition : les 
+ *     successeurs de E sont alors (E & boucles) | ((E & avances) << 1) ;
+ *   - sinon, 'masques' donne les nb_mots mots des successeurs de l'état e 
+ *     par la classe l, à partir de l'indice (e*nb_classes+l)*nb_mots.
+ * Les pointeurs inutilisés valent NULL.
+ *
+ * Un automate compilé n'est jamais modifié après sa création : il peut être
+ * partagé en lecture entre plusieurs fils d'exécution.
+ */
+typedef struct Automate_compile {
+	int nb_etats;
+	int nb_lettres;
+	int nb_mots;
+	int * etats;
+	char * lettres;
+	int indice_lettre[256];
+	int nb_classes;
+	int classe[256];
+	int * debuts;
+	int * fins;
+	uint64_t * initiaux;
+	uint64_t * finaux;
+	uint64_t * boucles;
+	uint64_t * avances;
+	uint64_t * masques;
+} Automate_compile;
+
+/**
+ * @brief Nombre maximal d'états d'un automate compilé dont les transitions
+ *        sont rangées sous forme de masques de bits.
+ */
+#define NB_ETATS_PARALLELES 256
+
+/**
+ * @brief Compile un automate.
+ *
+ * L'automate compilé est indépendant de l'automate passé en paramètre, qui
+ * peut être modifié ou libéré ensuite.
+ *
+ * @param automate Un automate.
+ * @return L'automate compilé, à libérer avec liberer_automate_compile().
+ */
+Automate_compile * compiler_automate( const Automate * automate );
+
+/**
+ * @brief Libère la mémoire d'un automate compilé.
+ *
+ * @param automate Un automate compilé.
+ */
+void liberer_automate_compile( Automate_compile * automate );
+
+/**
+ * @brief Renvoie le numéro dense d'un état à partir de son numéro d'origine,
+ *        ou -1 si l'état n'est pas un état de l'automate.
+ *
+ * @param automate Un automate compilé.
+ * @param etat Le numéro d'origine d'un état.
+ * @return Le numéro dense de l'état.
+ */
+int indice_etat_compile( const Automate_compile * automate, int etat );
+
+/**
+ * @brief Calcule, sur des ensembles d'états denses représentés par des bits,
+ *        l'ensemble des états accessibles depuis 'etats' en lisant une
+ *        lettre.
+ *
+ * 'etats' et 'res' sont des tableaux de automate->nb_mots mots qui ne 
+ * doivent pas se recouvrir. 'res' est entièrement réécrit.
+ *
+ * @param automate Un automate compilé.
+ * @param etats Les états de départ.
+ * @param lettre Une lettre.
+ * @param res Les états d'arrivée.
+ * @return 1 si 'res' n'est pas vide, 0 sinon.
+ */
+int delta_bits_compile(
+	const Automate_compile * automate, const uint64_t * etats, char lettre,
+	uint64_t * res
+);
+
+/**
+ * @brief Équivalent de delta() sur un automate compilé.
+ *
+ * Les états de 'etats_courants' et de l'ensemble renvoyé sont numérotés 
+ * comme dans l'automate d'origine. Les états inconnus sont ignorés.
+ *
+ * @param automate Un automate compilé.
+ * @param etats_courants L'ensemble des états origines.
+ * @param lettre Une lettre.
+ * @return L'ensemble des états accessibles, à libérer par l'utilisateur.
+ */
+Ensemble * delta_compile(
+	const Automate_compile * automate, const Ensemble * etats_courants,
+	char lettre
+);
+
+/**
+ * @brief Équivalent de delta_star() sur un automate compilé.
+ *
+ * @param automate Un automate compilé.
+ * @param etats_courants L'ensemble des états origines.
+ * @param mot Le mot à lire.
+ * @return L'ensemble des états accessibles, à libérer par l'utilisateur.
+ */
+Ensemble * delta_star_compile(
+	const Automate_compile * automate, const Ensemble * etats_courants,
+	const char * mot
+);
+
+/**
+ * @brief Équivalent de delta_star_octets() sur un automate compilé.
+ *
+ * @param automate Un automate compilé.
+ * @param etats_courants L'ensemble des états origines.
+ * @param mot Les lettres à lire.
+ * @param taille Le nombre de lettres à lire.
+ * @return L'ensemble des états accessibles, à libérer par l'utilisateur.
+ */
+Ensemble * delta_star_octets_compile(
+	const Automate_compile * automate, const Ensemble * etats_courants,
+	const uint8_t * mot, size_t taille
+);
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu_octets() sur un automate compilé.
+ *
+ * @param automate Un automate compilé.
+ * @param mot Les lettres du mot.
+ * @param taille Le nombre de lettres du mot.
+ * @return 1 ou 0
+ */
+int le_mot_est_reconnu_octets_compile(
+	const Automate_compile * automate, const uint8_t * mot, size_t taille
+);
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu() sur un automate compilé.
+ *
+ * La lecture s'arrête dès que l'ensemble des états courants est vide.
+ * Aucune allocation n'est faite pour les automates d'au plus 1024 états.
+ *
+ * @param automate Un automate compilé.
+ * @param mot Le mot à reconnaître.
+ * @return 1 ou 0
+ */
+int le_mot_est_reconnu_compile(
+	const Automate_compile * automate, const char * mot
+);
+
+/**
+ * @brief Indique, pour chacun des n mots de 'mots', s'il est reconnu par 
+ *        l'automate compilé.
+ *
+ * resultats[i] reçoit le_mot_est_reconnu_compile( automate, mots[i] ). Les 
+ * mots sont répartis entre nb_threads fils d'exécution, dont le fil 
+ * appelant ; si nb_threads est négatif ou nul, on prend le nombre de 
+ * processeurs disponibles.
+ *
+ * Les fils ne font que lire l'automate : chacun a ses propres ensembles de
+ * travail, alloués une fois pour toutes. Le même automate compilé peut donc
+ * servir à plusieurs appels simultanés.
+ *
+ * @param automate Un automate compilé.
+ * @param mots Les mots à reconnaître.
+ * @param n Le nombre de mots.
+ * @param resultats Un tableau de n entiers, qui reçoit les résultats.
+ * @param nb_threads Le nombre de fils d'exécution.
+ */
+void reconnaitre_mots_compile(
+	const Automate_compile * automate, const char * const * mots, size_t n,
+	int * resultats, int nb_threads
+);
+
+/**
+ * @brief Équivalent de reconnaitre_mots_compile() sur un automate, qui est
+ *        compilé une fois pour tous les mots.
+ *
+ * L'automate n'est pas modifié et n'est lu que pendant sa compilation, 
+ * avant la création des fils d'exécution.
+ *
+ * @param automate Un automate.
+ * @param mots Les mots à reconnaître.
+ * @param n Le nombre de mots.
+ * @param resultats Un tableau de n entiers, qui reçoit les résultats.
+ * @param nb_threads Le nombre de fils d'exécution.
+ */
+void reconnaitre_mots(
+	const Automate * automate, const char * const * mots, size_t n,
+	int * resultats, int nb_threads
+);
+
+/**
+ * @brief Le type d'une lecture en cours d'un mot donné par morceaux.
+ */
+typedef struct Lecteur_compile Lecteur_compile;
+
+/**
+ * @brief Commence la lecture d'un mot dont les lettres seront données par 
+ *        morceaux à nourrir_lecture_compile().
+ *
+ * Seuls les états courants sont gardés d'un morceau à l'autre : le mot n'a
+ * jamais besoin d'être entièrement en mémoire. L'automate compilé doit 
+ * rester valide jusqu'à fin_lecture_compile().
+ *
+ * @param automate Un automate compilé.
+ * @return La lecture, à terminer avec fin_lecture_compile().
+ */
+Lecteur_compile * debut_lecture_compile( const Automate_compile * automate );
+
+/**
+ * @brief Lit les 'taille' lettres suivantes du mot.
+ *
+ * Le tampon n'a pas à se terminer par un '\0', et un '\0' qu'il contient 
+ * est lu comme une lettre.
+ *
+ * @param lecteur Une lecture en cours.
+ * @param tampon Les lettres à lire.
+ * @param taille Le nombre de lettres à lire.
+ * @return 0 si l'ensemble des états courants est devenu vide : la suite du 
+ *         mot peut alors être ignorée, car il ne sera pas reconnu. 1 sinon.
+ */
+int nourrir_lecture_compile(
+	Lecteur_compile * lecteur, const char * tampon, size_t taille
+);
+
+/**
+ * @brief Termine une lecture et libère sa mémoire.
+ *
+ * @param lecteur Une lecture en cours.
+ * @return 1 si le mot formé des morceaux lus est reconnu, 0 sinon.
+ */
+int fin_lecture_compile( Lecteur_compile * lecteur );
+
+/**
+ * @brief Indique si le contenu d'un fichier est un mot reconnu par 
+ *        l'automate compilé.
+ *
+ * Un fichier ordinaire est projeté en mémoire et lu sans copie ; les pages 
+ * déjà lues sont rendues au système au fur et à mesure. Les autres fichiers
+ * (tubes...), les fichiers qui ne peuvent pas être projetés et ceux qui 
+ * annoncent une taille nulle (fichiers de /proc...) sont lus par morceaux.
+ *
+ * @param automate Un automate compilé.
+ * @param chemin Le chemin du fichier.
+ * @return 1 ou 0, ou -1 si le fichier n'a pas pu être lu.
+ */
+int le_fichier_est_reconnu_compile(
+	const Automate_compile * automate, const char * chemin
+);
+
+/**
+ * @brief Équivalent de le_fichier_est_reconnu_compile() sur un automate.
+ *
+ * @param automate Un automate.
+ * @param chemin Le chemin du fichier.
+ * @return 1 ou 0, ou -1 si le fichier n'a pas pu être lu.
+ */
+int le_fichier_est_reconnu( const Automate * automate, const char * chemin );
+
+#endif
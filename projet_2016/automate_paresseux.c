@@ -0,0 +1,289 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate_paresseux.h"
+#include "outils.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Valeurs particulières des transitions du cache : la transition n'a pas 
+ * encore été calculée, ou elle mène à l'ensemble vide.
+ */
+#define INCONNU -2
+#define MORT -1
+
+/*
+ * Renvoyé par etat_du_cache() quand le cache a été vidé trop souvent : la 
+ * fin du mot doit être lue par simulation.
+ */
+#define ABANDON -3
+
+static int comparer_entiers( const void * a, const void * b ){
+	int x = *(const int *) a;
+	int y = *(const int *) b;
+	return ( x > y ) - ( x < y );
+}
+
+static int est_final_paresseux( const Automate_compile * automate, int e ){
+	return ( automate->finaux[ e / 64 ] >> ( e % 64 ) ) & 1;
+}
+
+/*
+ * Mémoire occupée par un état du cache formé de 'nb' états de l'automate : 
+ * ses éléments, son entrée dans le dictionnaire, sa ligne de transitions et
+ * son indicateur d'état final.
+ */
+static size_t cout_etat( const Automate_paresseux * automate, int nb ){
+	return (size_t) nb * sizeof(int) 
+		+ sizeof(size_t) + sizeof(uint64_t) + 2 * sizeof(int)
+		+ (size_t) automate->automate->nb_classes * sizeof(int) + 1;
+}
+
+static size_t memoire_cache( const Automate_paresseux * automate ){
+	const Sous_ensembles * etats = &automate->etats;
+	return etats->nb_elements * sizeof(int) 
+		+ (size_t) etats->nb * ( cout_etat( automate, 0 ) );
+}
+
+static void vider_cache( Automate_paresseux * automate ){
+	detruire_sous_ensembles( &automate->etats );
+	initialiser_sous_ensembles( &automate->etats );
+	automate->initial = automate->nb_initiaux ? INCONNU : MORT;
+	automate->lettres_depuis_vidage = 0;
+	automate->nb_vidages++;
+}
+
+/*
+ * Renvoie le numéro, dans le cache, de l'état formé des 'nb' états triés de 
+ * 'etats', en l'y ajoutant au besoin. Si le cache est plein, il est vidé 
+ * d'abord : les numéros renvoyés auparavant ne sont alors plus valides. 
+ * Renvoie ABANDON si le cache précédent n'a pas servi assez longtemps.
+ */
+static int etat_du_cache( 
+	Automate_paresseux * automate, const int * etats, int nb
+){
+	int res = trouver_sous_ensemble( &automate->etats, etats, nb );
+	if( res >= 0 ){
+		return res;
+	}
+	int nb_etats = nb_sous_ensembles( &automate->etats );
+	if( 
+		nb_etats > 0 && 
+		memoire_cache( automate ) + cout_etat( automate, nb ) > 
+			automate->memoire_max
+	){
+		int rentable = automate->lettres_depuis_vidage >= 
+			(size_t) AUTOMATE_PARESSEUX_LETTRES_PAR_ETAT * nb_etats;
+		vider_cache( automate );
+		if( ! rentable ){
+			return ABANDON;
+		}
+	}
+
+	res = ajouter_sous_ensemble( &automate->etats, etats, nb, NULL );
+	int nb_classes = automate->automate->nb_classes;
+	if( res >= automate->capacite ){
+		automate->capacite = 2 * automate->capacite + 16;
+		automate->transitions = (int *) xrealloc( 
+			automate->transitions, 
+			(size_t) automate->capacite * nb_classes * sizeof(int) + 1
+		);
+		automate->finaux = (char *) xrealloc( 
+			automate->finaux, automate->capacite 
+		);
+	}
+	int * ligne = automate->transitions + (size_t) res * nb_classes;
+	for( int l = 0; l < nb_classes; l++ ){
+		ligne[l] = INCONNU;
+	}
+	automate->finaux[res] = 0;
+	for( int i = 0; i < nb && ! automate->finaux[res]; i++ ){
+		automate->finaux[res] = est_final_paresseux( automate->automate, etats[i] );
+	}
+	return res;
+}
+
+static void nouvelle_generation( Automate_paresseux * automate ){
+	if( ++automate->generation == 0 ){
+		memset( 
+			automate->marques, 0, 
+			automate->automate->nb_etats * sizeof(uint32_t) 
+		);
+		automate->generation = 1;
+	}
+}
+
+/*
+ * Range dans 'res' les successeurs par la classe de lettres 'l' des 'nb' états 
+ * de 'etats', sans doublons, et renvoie leur nombre.
+ */
+static int successeurs_paresseux(
+	Automate_paresseux * automate, const int * etats, int nb, int l, int * res
+){
+	const Automate_compile * compile = automate->automate;
+	int nb_res = 0;
+	nouvelle_generation( automate );
+	for( int i = 0; i < nb; i++ ){
+		const int * debut = 
+			compile->debuts + (size_t) etats[i] * compile->nb_classes + l;
+		for( int k = debut[0]; k < debut[1]; k++ ){
+			int fin = compile->fins[k];
+			if( automate->marques[fin] != automate->generation ){
+				automate->marques[fin] = automate->generation;
+				res[ nb_res++ ] = fin;
+			}
+		}
+	}
+	return nb_res;
+}
+
+/*
+ * Lit la fin du mot par simulation de l'automate, depuis les 'nb' états de 
+ * 'etats', sans passer par le cache.
+ */
+static int simuler_paresseux(
+	Automate_paresseux * automate, const int * etats, int nb, const char * mot
+){
+	const Automate_compile * compile = automate->automate;
+	int * courant = automate->tampon_simulation;
+	int * suivant = automate->tampon;
+	automate->nb_simulations++;
+	memmove( courant, etats, nb * sizeof(int) );
+	for( ; *mot && nb; mot++ ){
+		int l = compile->classe[ (unsigned char) *mot ];
+		if( l < 0 ){
+			return 0;
+		}
+		nb = successeurs_paresseux( automate, courant, nb, l, suivant );
+		int * tmp = courant;
+		courant = suivant;
+		suivant = tmp;
+	}
+	for( int i = 0; i < nb; i++ ){
+		if( est_final_paresseux( compile, courant[i] ) ){
+			return 1;
+		}
+	}
+	return 0;
+}
+
+Automate_paresseux * creer_automate_paresseux( 
+	const Automate * automate, size_t memoire_max 
+){
+	Automate_paresseux * res = 
+		(Automate_paresseux *) xmalloc( sizeof(Automate_paresseux) );
+	res->automate = compiler_automate( automate );
+	res->memoire_max = 
+		memoire_max ? memoire_max : AUTOMATE_PARESSEUX_MEMOIRE_DEFAUT;
+	initialiser_sous_ensembles( &res->etats );
+	res->transitions = NULL;
+	res->finaux = NULL;
+	res->capacite = 0;
+
+	int nb_etats = res->automate->nb_etats;
+	res->initiaux = (int *) xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	res->tampon = (int *) xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	res->tampon_simulation = (int *) xmalloc( ( nb_etats + 1 ) * sizeof(int) );
+	res->marques = (uint32_t *) xmalloc( ( nb_etats + 1 ) * sizeof(uint32_t) );
+	memset( res->marques, 0, ( nb_etats + 1 ) * sizeof(uint32_t) );
+	res->generation = 0;
+	res->nb_initiaux = 0;
+	for( int i = 0; i < nb_etats; i++ ){
+		if( ( res->automate->initiaux[ i / 64 ] >> ( i % 64 ) ) & 1 ){
+			res->initiaux[ res->nb_initiaux++ ] = i;
+		}
+	}
+
+	res->lettres_depuis_vidage = 0;
+	res->initial = res->nb_initiaux ? INCONNU : MORT;
+	res->nb_vidages = 0;
+	res->nb_simulations = 0;
+	return res;
+}
+
+void liberer_automate_paresseux( Automate_paresseux * automate ){
+	if( automate ){
+		liberer_automate_compile( automate->automate );
+		detruire_sous_ensembles( &automate->etats );
+		xfree( automate->transitions );
+		xfree( automate->finaux );
+		xfree( automate->initiaux );
+		xfree( automate->tampon );
+		xfree( automate->tampon_simulation );
+		xfree( automate->marques );
+		xfree( automate );
+	}
+}
+
+int le_mot_est_reconnu_paresseux( 
+	Automate_paresseux * automate, const char * mot 
+){
+	const Automate_compile * compile = automate->automate;
+	int nb_classes = compile->nb_classes;
+	int etat = automate->initial;
+	if( etat == INCONNU ){
+		etat = etat_du_cache( 
+			automate, automate->initiaux, automate->nb_initiaux 
+		);
+		if( etat == ABANDON ){
+			return simuler_paresseux( 
+				automate, automate->initiaux, automate->nb_initiaux, mot 
+			);
+		}
+		automate->initial = etat;
+	}
+
+	for( ; *mot && etat != MORT; mot++ ){
+		int l = compile->classe[ (unsigned char) *mot ];
+		if( l < 0 ){
+			return 0;
+		}
+		int suivant = automate->transitions[ (size_t) etat * nb_classes + l ];
+		if( suivant == INCONNU ){
+			int taille;
+			const int * etats = 
+				get_sous_ensemble( &automate->etats, etat, &taille );
+			int nb = successeurs_paresseux( 
+				automate, etats, taille, l, automate->tampon 
+			);
+			int nb_vidages = automate->nb_vidages;
+			if( nb == 0 ){
+				suivant = MORT;
+			}else{
+				qsort( automate->tampon, nb, sizeof(int), comparer_entiers );
+				suivant = etat_du_cache( automate, automate->tampon, nb );
+				if( suivant == ABANDON ){
+					return simuler_paresseux( 
+						automate, automate->tampon, nb, mot + 1 
+					);
+				}
+			}
+			// Si le cache vient d'être vidé, 'etat' n'y est plus.
+			if( nb_vidages == automate->nb_vidages ){
+				automate->transitions[ (size_t) etat * nb_classes + l ] = suivant;
+			}
+		}
+		automate->lettres_depuis_vidage++;
+		etat = suivant;
+	}
+	return etat != MORT && automate->finaux[etat];
+}
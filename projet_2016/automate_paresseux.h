@@ -0,0 +1,116 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file automate_paresseux.h */ 
+
+#ifndef __AUTOMATE_PARESSEUX_H__
+#define __AUTOMATE_PARESSEUX_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "automate.h"
+#include "automate_compile.h"
+#include "sous_ensembles.h"
+
+/**
+ * @brief Mémoire utilisée par défaut par le cache d'un automate paresseux.
+ */
+#define AUTOMATE_PARESSEUX_MEMOIRE_DEFAUT ( (size_t) 8 << 20 )
+
+/**
+ * @brief Le type d'un automate déterminisé à la demande.
+ *
+ * Un automate paresseux reconnaît des mots comme l'automate déterministe 
+ * de son automate d'origine, mais ne construit les états (des ensembles 
+ * d'états de l'automate compilé) et les transitions de cet automate 
+ * déterministe qu'au moment où la lecture d'un mot en a besoin. Ils sont 
+ * gardés dans un cache pour les mots suivants : une lettre dont la 
+ * transition est déjà connue ne coûte qu'une lecture de tableau.
+ *
+ * La mémoire du cache est bornée. Quand elle est pleine, le cache est vidé
+ * en entier et reconstruit au fil des lectures suivantes. Si le cache doit 
+ * être vidé alors qu'on n'a lu que peu de lettres depuis le vidage précédent
+ * (moins de AUTOMATE_PARESSEUX_LETTRES_PAR_ETAT lettres par état créé), la
+ * fin du mot est lue par une simulation directe de l'automate non 
+ * déterministe.
+ *
+ * Comme la lecture d'un mot modifie le cache, un automate paresseux ne doit
+ * pas être utilisé par plusieurs fils d'exécution en même temps.
+ */
+typedef struct Automate_paresseux {
+	Automate_compile * automate;
+	size_t memoire_max;
+	Sous_ensembles etats;
+	int * transitions;
+	char * finaux;
+	int capacite;
+	int initial;
+	int * initiaux;
+	int nb_initiaux;
+	int * tampon;
+	int * tampon_simulation;
+	uint32_t * marques;
+	uint32_t generation;
+	size_t lettres_depuis_vidage;
+	int nb_vidages; //!< Nombre de fois où le cache a été vidé.
+	int nb_simulations; //!< Nombre de mots terminés par simulation.
+} Automate_paresseux;
+
+/**
+ * @brief Nombre minimal de lettres lues par état créé entre deux vidages du
+ *        cache pour que le cache reste utilisé.
+ */
+#define AUTOMATE_PARESSEUX_LETTRES_PAR_ETAT 10
+
+/**
+ * @brief Crée un automate paresseux à partir d'un automate.
+ *
+ * L'automate passé en paramètre est compilé (voir compiler_automate()) : il
+ * peut être modifié ou libéré ensuite sans effet sur l'automate paresseux.
+ *
+ * @param automate Un automate.
+ * @param memoire_max La taille maximale du cache, en octets, ou 0 pour 
+ *                    AUTOMATE_PARESSEUX_MEMOIRE_DEFAUT.
+ * @return L'automate paresseux, à libérer avec liberer_automate_paresseux().
+ */
+Automate_paresseux * creer_automate_paresseux( 
+	const Automate * automate, size_t memoire_max 
+);
+
+/**
+ * @brief Libère la mémoire d'un automate paresseux.
+ *
+ * @param automate Un automate paresseux.
+ */
+void liberer_automate_paresseux( Automate_paresseux * automate );
+
+/**
+ * @brief Équivalent de le_mot_est_reconnu() sur un automate paresseux.
+ *
+ * @param automate Un automate paresseux.
+ * @param mot Le mot à reconnaître.
+ * @return 1 ou 0
+ */
+int le_mot_est_reconnu_paresseux( 
+	Automate_paresseux * automate, const char * mot 
+);
+
+#endif
@@ -519,6 +519,46 @@ avl_t_find (struct avl_traverser *trav, struct avl_table *tree, void *item)
   return NULL;
 }
 
+/* Searches for the smallest item in |tree| that is not less than
+   |item|.  If found, initializes |trav| to it and returns it.
+   If there is no such item, initializes |trav| to the null item
+   and returns |NULL|. */
+void *
+avl_t_find_ge (struct avl_traverser *trav, struct avl_table *tree, void *item)
+{
+  struct avl_node *p, *q;
+  struct avl_node *found = NULL;
+  size_t found_height = 0;
+
+  assert (trav != NULL && tree != NULL && item != NULL);
+  trav->avl_table = tree;
+  trav->avl_height = 0;
+  trav->avl_generation = tree->avl_generation;
+  for (p = tree->avl_root; p != NULL; p = q)
+    {
+      int cmp = tree->avl_compare (item, p->avl_data, tree->avl_param);
+
+      if (cmp <= 0)
+        {
+          found = p;
+          found_height = trav->avl_height;
+          if (cmp == 0)
+            break;
+          q = p->avl_link[0];
+        }
+      else
+        q = p->avl_link[1];
+
+      assert (trav->avl_height < AVL_MAX_HEIGHT);
+      trav->avl_stack[trav->avl_height++] = p;
+    }
+
+  /* The nodes above |found| on the search path are its ancestors. */
+  trav->avl_height = found_height;
+  trav->avl_node = found;
+  return found != NULL ? found->avl_data : NULL;
+}
+
 /* Attempts to insert |item| into |tree|.
    If |item| is inserted successfully, it is returned and |trav| is
    initialized to its location.
@@ -889,3 +929,54 @@ void *
 int avl_t_is_null(struct avl_traverser * t){
 	return t->avl_node == NULL;
 }
+
+/* Builds a balanced subtree of |tree| holding the |n| items in |items|.
+   Stores the subtree's height into |*height|. */
+static struct avl_node *
+build_sorted (struct avl_table *tree, void **items, size_t n, int *height)
+{
+  struct avl_node *node;
+  int lh, rh;
+  size_t mid = n / 2;
+
+  if (n == 0)
+    {
+      *height = 0;
+      return NULL;
+    }
+
+  node = tree->avl_alloc->libavl_malloc (tree->avl_alloc, sizeof *node);
+  if (node == NULL)
+    {
+      *height = -1;
+      return NULL;
+    }
+  node->avl_data = items[mid];
+  node->avl_link[0] = build_sorted (tree, items, mid, &lh);
+  node->avl_link[1] = build_sorted (tree, items + mid + 1, n - mid - 1, &rh);
+  if (lh < 0 || rh < 0)
+    {
+      *height = -1;
+      return node;
+    }
+  node->avl_balance = rh - lh;
+  *height = (lh > rh ? lh : rh) + 1;
+  return node;
+}
+
+/* Fills empty |tree| with the |n| items in |items|, which must be
+   in strictly increasing order for |tree|'s comparison function.
+   Runs in linear time without any comparison.
+   Returns nonzero on success, zero on memory allocation failure,
+   in which case the tree must not be used anymore. */
+int
+avl_build_sorted (struct avl_table *tree, void **items, size_t n)
+{
+  int height;
+
+  assert (tree != NULL && tree->avl_count == 0 && (items != NULL || n == 0));
+  tree->avl_root = build_sorted (tree, items, n, &height);
+  tree->avl_count = n;
+  tree->avl_generation++;
+  return height >= 0;
+}
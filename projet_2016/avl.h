@@ -95,6 +95,7 @@ void *avl_delete (struct avl_table *, const void *);
 void *avl_find (const struct avl_table *, const void *);
 void avl_assert_insert (struct avl_table *, void *);
 void *avl_assert_delete (struct avl_table *, void *);
+int avl_build_sorted (struct avl_table *, void **, size_t);
 
 #define avl_count(table) ((size_t) (table)->avl_count)
 
@@ -103,6 +104,7 @@ void avl_t_init (struct avl_traverser *, struct avl_table *);
 void *avl_t_first (struct avl_traverser *, struct avl_table *);
 void *avl_t_last (struct avl_traverser *, struct avl_table *);
 void *avl_t_find (struct avl_traverser *, struct avl_table *, void *);
+void *avl_t_find_ge (struct avl_traverser *, struct avl_table *, void *);
 void *avl_t_insert (struct avl_traverser *, struct avl_table *, void *);
 void *avl_t_copy (struct avl_traverser *, const struct avl_traverser *);
 void *avl_t_next (struct avl_traverser *);
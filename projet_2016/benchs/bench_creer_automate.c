@@ -0,0 +1,65 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+#include <time.h>
+
+/*
+ * Mesure la construction et la destruction d'un automate ayant beaucoup de
+ * transitions : ce sont les allocations des tables et des ensembles qui 
+ * dominent.
+ */
+
+#define NB_ETATS 50000
+#define NB_TRANSITIONS_PAR_ETAT 6
+
+void chronometrer( const char * nom, Automate * automate ){
+	clock_t debut = clock();
+	int i, j;
+	for( i=0; i<NB_ETATS; i++ ){
+		for( j=0; j<NB_TRANSITIONS_PAR_ETAT; j++ ){
+			ajouter_transition(
+				automate, i, 'a' + j % 3,
+				( i * 7919 + j * 104729 ) % NB_ETATS
+			);
+		}
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, NB_ETATS - 1 );
+	double construction = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	debut = clock();
+	liberer_automate( automate );
+	double destruction = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	printf(
+		"%s, %d transitions : construction %.3f s, destruction %.3f s\n",
+		nom, NB_ETATS * NB_TRANSITIONS_PAR_ETAT, construction, destruction
+	);
+}
+
+int main(){
+	chronometrer( "creer_automate", creer_automate() );
+	chronometrer( "creer_automate_arena", creer_automate_arena() );
+	return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+#include <time.h>
+
+/*
+ * Mesure la déterminisation, puis la minimisation, de deux automates non 
+ * déterministes :
+ *   - celui des mots qui finissent par un long mot fixé (beaucoup d'états,
+ *     mais des sous-ensembles petits) ;
+ *   - celui des mots dont la n-ième lettre avant la fin est un a (peu 
+ *     d'états, mais 2^(n+1) sous-ensembles).
+ */
+
+#define LONGUEUR_MOT 20000
+#define N 15
+
+Automate * creer_automate_suffixe( int longueur ){
+	Automate * automate = creer_automate();
+	unsigned int graine = 12345;
+	int i;
+	for( i=0; i<4; i++ ){
+		ajouter_transition( automate, 0, 'a' + i, 0 );
+	}
+	for( i=0; i<longueur; i++ ){
+		graine = graine * 1103515245 + 12345;
+		ajouter_transition( automate, i, 'a' + ( graine >> 16 ) % 4, i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, longueur );
+	return automate;
+}
+
+Automate * creer_automate_n_ieme_lettre( int n ){
+	Automate * automate = creer_automate();
+	int i;
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<=n; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, n+1 );
+	return automate;
+}
+
+void chronometrer( const char * nom, Automate * automate ){
+	clock_t debut = clock();
+	Automate * deterministe = creer_automate_deterministe( automate );
+	double duree = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+	printf(
+		"creer_automate_deterministe, %s, %d -> %d etats : %.3f s\n",
+		nom, taille_ensemble( get_etats( automate ) ),
+		taille_ensemble( get_etats( deterministe ) ), duree
+	);
+
+	debut = clock();
+	Automate * minimal = creer_automate_minimal( deterministe, NULL );
+	duree = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+	printf(
+		"creer_automate_minimal, %s, %d -> %d etats : %.3f s\n",
+		nom, taille_ensemble( get_etats( deterministe ) ),
+		taille_ensemble( get_etats( minimal ) ), duree
+	);
+
+	liberer_automate( minimal );
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+}
+
+int main(){
+	chronometrer( "suffixe", creer_automate_suffixe( LONGUEUR_MOT ) );
+	chronometrer( "n-ieme lettre", creer_automate_n_ieme_lettre( N ) );
+	return 0;
+}
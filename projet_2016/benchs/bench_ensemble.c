@@ -0,0 +1,71 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "ensemble.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <time.h>
+
+/*
+ * Mesure l'union, l'intersection et la différence de deux grands ensembles
+ * représentés par des arbres (les éléments négatifs empêchent la 
+ * représentation par bits).
+ */
+
+#define NB_ELEMENTS 200000
+#define NB_REPETITIONS 5
+
+int main(){
+	Ensemble * ens1 = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * ens2 = creer_ensemble( NULL, NULL, NULL );
+	int i;
+	for( i=0; i<NB_ELEMENTS; i++ ){
+		ajouter_element( ens1, -2*i );
+		ajouter_element( ens2, -3*i );
+	}
+
+	clock_t debut = clock();
+	for( i=0; i<NB_REPETITIONS; i++ ){
+		liberer_ensemble( creer_union_ensemble( ens1, ens2 ) );
+		liberer_ensemble( creer_intersection_ensemble( ens1, ens2 ) );
+		liberer_ensemble( creer_difference_ensemble( ens1, ens2 ) );
+	}
+	double operations = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	debut = clock();
+	for( i=0; i<NB_REPETITIONS; i++ ){
+		Ensemble * ens = copier_ensemble( ens1 );
+		ajouter_elements( ens, ens2 );
+		retirer_elements( ens, ens1 );
+		liberer_ensemble( ens );
+	}
+	double en_place = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+
+	printf(
+		"union/intersection/difference, %d elements x %d : %.3f s, en place %.3f s\n",
+		NB_ELEMENTS, NB_REPETITIONS, operations, en_place
+	);
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+	return 0;
+}
@@ -0,0 +1,175 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "automate_compile.h"
+#include "automate_paresseux.h"
+#include "outils.h"
+
+#include <string.h>
+#include <time.h>
+
+/*
+ * Mesure le temps de le_mot_est_reconnu() sur des mots longs, ainsi que 
+ * celui de ses équivalents sur un automate compilé et sur un automate 
+ * paresseux. Compilés, les deux petits automates sont lus par masques de
+ * bits ; celui de mot_to_automate() est trop grand pour cela.
+ * le_mot_est_reconnu() ne compile jamais l'automate : seul l'appelant sait
+ * si la compilation sera amortie.
+ */
+
+#define LONGUEUR_MOT 200000
+#define NB_REPETITIONS 5
+
+char * creer_mot( int longueur ){
+	char * mot = xmalloc( longueur + 1 );
+	int i;
+	for( i=0; i<longueur; i++ ){
+		mot[i] = "abc"[ (i*7 + i/3) % 3 ];
+	}
+	mot[longueur-1] = 'c';
+	mot[longueur] = '\0';
+	return mot;
+}
+
+/*
+ * Automate non déterministe à 4 états qui reconnaît les mots contenant 
+ * un facteur "ab" et qui finissent par "c" : plusieurs états sont actifs à chaque lettre.
+ */
+Automate * creer_automate_facteur_ab(){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'c', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'a', 2 );
+	ajouter_transition( automate, 2, 'b', 2 );
+	ajouter_transition( automate, 2, 'c', 2 );
+	ajouter_transition( automate, 2, 'c', 3 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 3 );
+	return automate;
+}
+
+double chronometrer( const Automate * automate, const char * mot, int * reconnu ){
+	clock_t debut = clock();
+	int i;
+	for( i=0; i<NB_REPETITIONS; i++ ){
+		*reconnu = le_mot_est_reconnu( automate, mot );
+	}
+	return (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+}
+
+double chronometrer_compile(
+	const Automate * automate, const char * mot, int * reconnu
+){
+	Automate_compile * compile = compiler_automate( automate );
+	clock_t debut = clock();
+	int i;
+	for( i=0; i<NB_REPETITIONS; i++ ){
+		*reconnu = le_mot_est_reconnu_compile( compile, mot );
+	}
+	double duree = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+	liberer_automate_compile( compile );
+	return duree;
+}
+
+double chronometrer_paresseux(
+	const Automate * automate, const char * mot, int * reconnu
+){
+	Automate_paresseux * paresseux = creer_automate_paresseux( automate, 0 );
+	clock_t debut = clock();
+	int i;
+	for( i=0; i<NB_REPETITIONS; i++ ){
+		*reconnu = le_mot_est_reconnu_paresseux( paresseux, mot );
+	}
+	double duree = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+	liberer_automate_paresseux( paresseux );
+	return duree;
+}
+
+/*
+ * Automate non déterministe à N+1 états qui reconnaît les mots dont la N-ième
+ * lettre avant la fin est un 'a' : environ N/3 états sont actifs à chaque 
+ * lettre, et son déterminisé a 2^N états.
+ */
+#define N 12
+
+Automate * creer_automate_nieme_lettre(){
+	Automate * automate = creer_automate();
+	int i;
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'c', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( i=1; i<N; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+		ajouter_transition( automate, i, 'c', i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, N );
+	return automate;
+}
+
+void afficher( const char * nom, double duree, int reconnu ){
+	printf(
+		"%s, %d lettres x %d : %.3f s (%.1f ns/lettre), reconnu : %d\n",
+		nom, LONGUEUR_MOT, NB_REPETITIONS, duree,
+		1e9 * duree / ( (double) LONGUEUR_MOT * NB_REPETITIONS ), reconnu
+	);
+}
+
+int main(){
+	char * mot = creer_mot( LONGUEUR_MOT );
+	int reconnu;
+
+	Automate * automate = creer_automate_facteur_ab();
+	double duree = chronometrer( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu, facteur ab", duree, reconnu );
+	duree = chronometrer_compile( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu_compile, facteur ab", duree, reconnu );
+	duree = chronometrer_paresseux( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu_paresseux, facteur ab", duree, reconnu );
+	liberer_automate( automate );
+
+	automate = creer_automate_nieme_lettre();
+	duree = chronometrer( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu, n-ieme lettre", duree, reconnu );
+	duree = chronometrer_compile( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu_compile, n-ieme lettre", duree, reconnu );
+	duree = chronometrer_paresseux( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu_paresseux, n-ieme lettre", duree, reconnu );
+	liberer_automate( automate );
+
+	automate = mot_to_automate( mot );
+	duree = chronometrer( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu, mot_to_automate", duree, reconnu );
+	duree = chronometrer_compile( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu_compile, mot_to_automate", duree, reconnu );
+	duree = chronometrer_paresseux( automate, mot, &reconnu );
+	afficher( "le_mot_est_reconnu_paresseux, mot_to_automate", duree, reconnu );
+	liberer_automate( automate );
+
+	xfree( mot );
+	return 0;
+}
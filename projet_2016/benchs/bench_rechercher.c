@@ -0,0 +1,167 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "recherche.h"
+#include "outils.h"
+
+#include <string.h>
+#include <time.h>
+
+/*
+ * Mesure rechercher() sur un long texte pseudo-aléatoire, pour un motif 
+ * court et un motif long, avec les deux politiques. Mesure aussi, sur des 
+ * textes de plus en plus longs, deux motifs dont les occurrences peuvent 
+ * être très longues : le temps par lettre doit rester constant.
+ */
+
+#define LONGUEUR_TEXTE 2000000
+
+/*
+ * Automate des mots "ab", "abc", ..., qui sont formés des 'longueur' 
+ * premières lettres de l'alphabet, avec au moins deux lettres.
+ */
+Automate * creer_automate_prefixes( int longueur ){
+	Automate * automate = creer_automate();
+	int i;
+	for( i=0; i<longueur; i++ ){
+		ajouter_transition( automate, i, 'a' + i % 4, i+1 );
+	}
+	for( i=2; i<=longueur; i++ ){
+		ajouter_etat_final( automate, i );
+	}
+	ajouter_etat_initial( automate, 0 );
+	return automate;
+}
+
+void action_compter( size_t debut, size_t fin, void * data ){
+	( *(size_t *) data )++;
+}
+
+/*
+ * Automate de (a|b)*b : toute occurrence peut commencer au début du texte.
+ */
+Automate * creer_automate_finit_par_b(){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'b', 1 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 1 );
+	return automate;
+}
+
+/*
+ * Automate de a|aa*c : sur une suite de a, les occurrences ont une lettre,
+ * mais chacune pourrait se prolonger jusqu'à la fin du texte.
+ */
+Automate * creer_automate_a_ou_a_etoile_c(){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 0, 'a', 2 );
+	ajouter_transition( automate, 2, 'a', 2 );
+	ajouter_transition( automate, 2, 'c', 3 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 1 );
+	ajouter_etat_final( automate, 3 );
+	return automate;
+}
+
+void chronometrer_croissance(
+	const char * nom, const Automate * automate, const char * texte,
+	Politique_recherche politique
+){
+	Recherche * recherche = creer_recherche( automate );
+	size_t longueur;
+	for( longueur = 10000; longueur <= LONGUEUR_TEXTE; longueur *= 4 ){
+		size_t nb = 0;
+		clock_t debut = clock();
+		rechercher( recherche, texte, longueur, politique, action_compter, &nb );
+		double duree = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+		printf(
+			"rechercher, %s, %zu lettres : %.3f s (%.1f ns/lettre), "
+			"%zu occurrences\n",
+			nom, longueur, duree, 1e9 * duree / longueur, nb
+		);
+	}
+	liberer_recherche( recherche );
+}
+
+void chronometrer( 
+	const char * nom, const Automate * automate, const char * texte 
+){
+	Recherche * recherche = creer_recherche( automate );
+	const char * politiques[] = { "toutes", "plus longue a gauche" };
+	int politique;
+	for( politique=0; politique<2; politique++ ){
+		size_t nb = 0;
+		clock_t debut = clock();
+		rechercher( 
+			recherche, texte, LONGUEUR_TEXTE, politique, action_compter, &nb 
+		);
+		double duree = (double) ( clock() - debut ) / CLOCKS_PER_SEC;
+		printf(
+			"rechercher, %s, %s, %d lettres : %.3f s (%.1f ns/lettre), "
+			"%zu occurrences\n",
+			nom, politiques[politique], LONGUEUR_TEXTE, duree, 
+			1e9 * duree / LONGUEUR_TEXTE, nb
+		);
+	}
+	liberer_recherche( recherche );
+}
+
+int main(){
+	char * texte = xmalloc( LONGUEUR_TEXTE );
+	unsigned int graine = 12345;
+	int i;
+	for( i=0; i<LONGUEUR_TEXTE; i++ ){
+		graine = graine * 1103515245 + 12345;
+		texte[i] = 'a' + ( graine >> 16 ) % 4;
+	}
+
+	Automate * automate = creer_automate_prefixes( 8 );
+	chronometrer( "8 lettres", automate, texte );
+	liberer_automate( automate );
+
+	automate = creer_automate_prefixes( 400 );
+	chronometrer( "400 lettres", automate, texte );
+	liberer_automate( automate );
+
+	for( i=0; i<LONGUEUR_TEXTE; i++ ){
+		texte[i] = "ab"[ texte[i] % 2 ];
+	}
+	automate = creer_automate_finit_par_b();
+	chronometrer_croissance( 
+		"(a|b)*b, toutes", automate, texte, RECHERCHE_TOUTES 
+	);
+	liberer_automate( automate );
+
+	memset( texte, 'a', LONGUEUR_TEXTE );
+	automate = creer_automate_a_ou_a_etoile_c();
+	chronometrer_croissance( 
+		"a|aa*c, plus longue a gauche", automate, texte, 
+		RECHERCHE_PLUS_LONGUE_A_GAUCHE 
+	);
+	liberer_automate( automate );
+
+	xfree( texte );
+	return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "automate.h"
+#include "automate_compile.h"
+#include "outils.h"
+
+#include <time.h>
+
+/*
+ * Mesure le débit de reconnaitre_mots() sur beaucoup de mots courts, selon
+ * le nombre de fils d'exécution, et le compare à des appels successifs de 
+ * le_mot_est_reconnu(). Le temps mesuré est le temps écoulé, et non le 
+ * temps processeur, qui additionne celui des différents fils.
+ */
+
+#define NB_MOTS 1000000
+#define LONGUEUR_MAX 32
+#define NB_ETATS 2000
+
+/*
+ * Automate des mots qui contiennent un facteur fixé de longueur 
+ * NB_ETATS : il est trop grand pour être lu par masques de bits.
+ */
+Automate * creer_automate_facteur(){
+	Automate * automate = creer_automate();
+	unsigned int graine = 12345;
+	int i;
+	for( i=0; i<4; i++ ){
+		ajouter_transition( automate, 0, 'a' + i, 0 );
+		ajouter_transition( automate, NB_ETATS, 'a' + i, NB_ETATS );
+	}
+	for( i=0; i<NB_ETATS; i++ ){
+		graine = graine * 1103515245 + 12345;
+		ajouter_transition( automate, i, 'a' + ( graine >> 16 ) % 4, i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, NB_ETATS );
+	return automate;
+}
+
+double maintenant(){
+	struct timespec t;
+	clock_gettime( CLOCK_MONOTONIC, &t );
+	return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+int main(){
+	char ** mots = xmalloc( NB_MOTS * sizeof(char *) );
+	int * resultats = xmalloc( NB_MOTS * sizeof(int) );
+	unsigned int graine = 42;
+	int i, j, nb_reconnus;
+	for( i=0; i<NB_MOTS; i++ ){
+		int taille = 1 + i % LONGUEUR_MAX;
+		mots[i] = xmalloc( taille + 1 );
+		for( j=0; j<taille; j++ ){
+			graine = graine * 1103515245 + 12345;
+			mots[i][j] = 'a' + ( graine >> 16 ) % 4;
+		}
+		mots[i][taille] = '\0';
+	}
+
+	Automate * automate = creer_automate_facteur();
+
+	double debut = maintenant();
+	nb_reconnus = 0;
+	for( i=0; i<NB_MOTS / 10; i++ ){
+		nb_reconnus += le_mot_est_reconnu( automate, mots[i] );
+	}
+	double duree = 10 * ( maintenant() - debut );
+	printf( 
+		"le_mot_est_reconnu, %d mots : %.3f s (estimation sur %d mots)\n",
+		NB_MOTS, duree, NB_MOTS / 10
+	);
+
+	int nb_threads[] = { 1, 2, 4, 8 };
+	for( j=0; j<4; j++ ){
+		debut = maintenant();
+		reconnaitre_mots( 
+			automate, (const char * const *) mots, NB_MOTS, resultats, 
+			nb_threads[j] 
+		);
+		duree = maintenant() - debut;
+		nb_reconnus = 0;
+		for( i=0; i<NB_MOTS; i++ ){
+			nb_reconnus += resultats[i];
+		}
+		printf( 
+			"reconnaitre_mots, %d mots, %d fils : %.3f s (%.1f Mmots/s), "
+			"reconnus : %d\n",
+			NB_MOTS, nb_threads[j], duree, NB_MOTS / duree / 1e6, nb_reconnus
+		);
+	}
+
+	liberer_automate( automate );
+	for( i=0; i<NB_MOTS; i++ ){
+		xfree( mots[i] );
+	}
+	xfree( mots );
+	xfree( resultats );
+	return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "couples.h"
+#include "outils.h"
+
+#include <string.h>
+
+#define NB_ALVEOLES_MIN 64
+
+/*
+ * Un couple est codé sur 64 bits : le premier entier dans les bits de 
+ * poids fort, le second dans les bits de poids faible.
+ */
+static uint64_t coder_couple( int premier, int second ){
+	return ( (uint64_t) (uint32_t) premier << 32 ) | (uint32_t) second;
+}
+
+static uint64_t hacher_couple( uint64_t couple ){
+	couple ^= couple >> 33;
+	couple *= 0xff51afd7ed558ccdULL;
+	couple ^= couple >> 33;
+	return couple;
+}
+
+static void allouer_alveoles( Couples * couples, size_t nb_alveoles ){
+	couples->nb_alveoles = nb_alveoles;
+	couples->cles = (uint64_t *) xmalloc( nb_alveoles * sizeof(uint64_t) );
+	couples->rangs = (size_t *) xmalloc( nb_alveoles * sizeof(size_t) );
+	couples->generations = (unsigned *) xmalloc( nb_alveoles * sizeof(unsigned) );
+	memset( couples->generations, 0, nb_alveoles * sizeof(unsigned) );
+	couples->generation = 1;
+}
+
+/*
+ * Renvoie l'alvéole qui contient le couple, ou l'alvéole libre où il 
+ * devrait être rangé.
+ */
+static size_t chercher_alveole( const Couples * couples, uint64_t couple ){
+	size_t masque = couples->nb_alveoles - 1;
+	size_t a = hacher_couple( couple ) & masque;
+	while( 
+		couples->generations[a] == couples->generation 
+		&& couples->cles[a] != couple 
+	){
+		a = ( a + 1 ) & masque;
+	}
+	return a;
+}
+
+/*
+ * Double la table. Les couples de l'ensemble sont ceux du tableau : il 
+ * suffit de les y ranger à nouveau.
+ */
+static void agrandir_alveoles( Couples * couples ){
+	xfree( couples->cles );
+	xfree( couples->rangs );
+	xfree( couples->generations );
+	allouer_alveoles( couples, 2 * couples->nb_alveoles );
+	for( size_t i = 0; i < couples->nb; i++ ){
+		size_t a = chercher_alveole( couples, couples->couples[i] );
+		couples->generations[a] = couples->generation;
+		couples->cles[a] = couples->couples[i];
+		couples->rangs[a] = i;
+	}
+}
+
+void initialiser_couples( Couples * couples ){
+	couples->capacite = NB_ALVEOLES_MIN / 2;
+	couples->couples = (uint64_t *) xmalloc( couples->capacite * sizeof(uint64_t) );
+	couples->nb = 0;
+	allouer_alveoles( couples, NB_ALVEOLES_MIN );
+}
+
+void detruire_couples( Couples * couples ){
+	xfree( couples->couples );
+	xfree( couples->cles );
+	xfree( couples->rangs );
+	xfree( couples->generations );
+}
+
+void vider_couples( Couples * couples ){
+	couples->nb = 0;
+	if( ++couples->generation == 0 ){
+		memset( couples->generations, 0, couples->nb_alveoles * sizeof(unsigned) );
+		couples->generation = 1;
+	}
+}
+
+size_t numeroter_couple( Couples * couples, int premier, int second ){
+	uint64_t couple = coder_couple( premier, second );
+	size_t a = chercher_alveole( couples, couple );
+	if( couples->generations[a] == couples->generation ){
+		return couples->rangs[a];
+	}
+	// On garde la table remplie au plus à moitié.
+	if( 2 * ( couples->nb + 1 ) > couples->nb_alveoles ){
+		agrandir_alveoles( couples );
+		a = chercher_alveole( couples, couple );
+	}
+	couples->generations[a] = couples->generation;
+	couples->cles[a] = couple;
+	couples->rangs[a] = couples->nb;
+	if( couples->nb == couples->capacite ){
+		couples->capacite *= 2;
+		couples->couples = (uint64_t *) xrealloc( 
+			couples->couples, couples->capacite * sizeof(uint64_t) 
+		);
+	}
+	couples->couples[ couples->nb++ ] = couple;
+	return couples->nb - 1;
+}
+
+int ajouter_couple( Couples * couples, int premier, int second ){
+	size_t nb = couples->nb;
+	return numeroter_couple( couples, premier, second ) == nb;
+}
+
+int est_un_couple( const Couples * couples, int premier, int second ){
+	size_t a = chercher_alveole( couples, coder_couple( premier, second ) );
+	return couples->generations[a] == couples->generation;
+}
+
+size_t nb_couples( const Couples * couples ){
+	return couples->nb;
+}
+
+void get_couple( const Couples * couples, size_t i, int * premier, int * second ){
+	*premier = (int) (uint32_t) ( couples->couples[i] >> 32 );
+	*second = (int) (uint32_t) couples->couples[i];
+}
@@ -0,0 +1,96 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __COUPLES_H__
+#define __COUPLES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Définit le type d'un ensemble de couples d'entiers.
+ *
+ * Les couples sont rangés dans un tableau, dans l'ordre où ils ont été 
+ * ajoutés, et dans une table de hachage à adressage ouvert qui sert à 
+ * savoir si un couple est déjà présent. Un couple n'entre qu'une fois dans
+ * le tableau : celui-ci peut servir de file pour un parcours en largeur.
+ *
+ * Chaque alvéole de la table porte la génération de sa dernière écriture :
+ * vider l'ensemble revient à changer de génération, sans effacer la table.
+ *
+ * La structure est publique pour pouvoir être incluse dans une autre 
+ * structure, mais ses champs ne doivent pas être manipulés directement.
+ */
+typedef struct Couples {
+	uint64_t * couples;
+	size_t nb;
+	size_t capacite;
+	uint64_t * cles;
+	size_t * rangs;
+	unsigned * generations;
+	size_t nb_alveoles;
+	unsigned generation;
+} Couples;
+
+/*
+ * Initialise un ensemble vide.
+ */
+void initialiser_couples( Couples * couples );
+
+/*
+ * Libère la mémoire d'un ensemble initialisé par initialiser_couples().
+ */
+void detruire_couples( Couples * couples );
+
+/*
+ * Retire tous les couples de l'ensemble, en temps constant.
+ */
+void vider_couples( Couples * couples );
+
+/*
+ * Ajoute le couple (premier, second) à la fin du tableau s'il n'est pas
+ * déjà dans l'ensemble. Renvoie 1 s'il a été ajouté, 0 sinon.
+ */
+int ajouter_couple( Couples * couples, int premier, int second );
+
+/*
+ * Comme ajouter_couple(), mais renvoie la place du couple dans le tableau,
+ * qu'il vienne d'être ajouté ou non. Un couple garde sa place tant que 
+ * l'ensemble n'est pas vidé : elle peut servir à le numéroter.
+ */
+size_t numeroter_couple( Couples * couples, int premier, int second );
+
+/*
+ * Renvoie 1 si le couple (premier, second) est dans l'ensemble, 0 sinon.
+ */
+int est_un_couple( const Couples * couples, int premier, int second );
+
+/*
+ * Renvoie le nombre de couples de l'ensemble.
+ */
+size_t nb_couples( const Couples * couples );
+
+/*
+ * Écrit dans *premier et *second le couple numéro i, dans l'ordre des 
+ * ajouts.
+ */
+void get_couple( const Couples * couples, size_t i, int * premier, int * second );
+
+#endif
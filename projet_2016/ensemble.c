@@ -27,6 +27,23 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define BITS_PAR_MOT 64
+
+/*
+ * Nombre de mots qu'un ensemble représenté par des bits peut toujours 
+ * utiliser, quel que soit son nombre d'éléments. Au-delà, on s'autorise
+ * BITSET_MOTS_PAR_ELEMENT mots par élément avant de basculer sur un arbre.
+ */
+#define BITSET_MOTS_MIN 8
+#define BITSET_MOTS_PAR_ELEMENT 8
 
 
 int* allouer_element( int val ){
@@ -39,37 +56,277 @@ void supprimer_element( int* element ){
 	xfree( element );
 }
 
-void next_iterators( Table_iterateur * it1, Table_iterateur * it2 ){
-	*it1 = iterateur_suivant_table(*it1);
-	*it2 = iterateur_suivant_table(*it2);
+static int est_bitset( const Ensemble* ensemble ){
+	return ensemble->table == NULL;
+}
+
+static uint64_t* allouer_mots( Ensemble* ensemble, size_t nb_mots ){
+	uint64_t* mots;
+	if( ensemble->pool ){
+		mots = (uint64_t*) allouer_pool(
+			ensemble->pool, nb_mots * sizeof(uint64_t)
+		);
+	}else{
+		mots = (uint64_t*) xmalloc( nb_mots * sizeof(uint64_t) );
+	}
+	memset( mots, 0, nb_mots * sizeof(uint64_t) );
+	return mots;
+}
+
+static void liberer_mots( Ensemble* ensemble ){
+	if( ! ensemble->mots ) return;
+	if( ensemble->pool ){
+		rendre_pool(
+			ensemble->pool, ensemble->mots, 
+			ensemble->nb_mots * sizeof(uint64_t)
+		);
+	}else{
+		xfree( ensemble->mots );
+	}
+	ensemble->mots = NULL;
+	ensemble->nb_mots = 0;
+}
+
+/*
+ * Garantit que le tableau de bits contient au moins nb_mots mots.
+ * Les mots ajoutés sont à 0.
+ */
+static void agrandir_mots( Ensemble* ensemble, size_t nb_mots ){
+	if( nb_mots <= ensemble->nb_mots ) return;
+	size_t capacite = 2 * ensemble->nb_mots;
+	if( capacite < nb_mots ) capacite = nb_mots;
+	uint64_t* mots = allouer_mots( ensemble, capacite );
+	if( ensemble->mots ){
+		memcpy( mots, ensemble->mots, ensemble->nb_mots * sizeof(uint64_t) );
+	}
+	liberer_mots( ensemble );
+	ensemble->mots = mots;
+	ensemble->nb_mots = capacite;
+}
+
+/*
+ * Renvoie le nombre de mots utiles du tableau de bits, c'est à dire sans 
+ * les mots nuls situés à la fin.
+ */
+static size_t mots_utilises( const Ensemble* ensemble ){
+	size_t n = ensemble->nb_mots;
+	while( n > 0 && ensemble->mots[n-1] == 0 ) n--;
+	return n;
+}
+
+/*
+ * Renvoie vrai si un tableau de bits de nb_mots mots reste raisonnable pour
+ * un ensemble de 'taille' éléments.
+ */
+static int bitset_suffisamment_dense( size_t nb_mots, size_t taille ){
+	size_t limite = BITSET_MOTS_PAR_ELEMENT * ( taille + 1 );
+	if( limite < BITSET_MOTS_MIN ) limite = BITSET_MOTS_MIN;
+	return nb_mots <= limite;
+}
+
+static int bitset_accepte( const Ensemble* ensemble, intptr_t element ){
+	return element >= 0 && bitset_suffisamment_dense( 
+		element / BITS_PAR_MOT + 1, ensemble->taille 
+	);
+}
+
+static Table* creer_table_ensemble( const Ensemble* ensemble ){
+	if( ensemble->pool ){
+		return creer_table_dans_pool(
+			ensemble->pool, ensemble->comparer_element,
+			ensemble->copier_element, ensemble->supprimer_element
+		);
+	}
+	return creer_table(
+		ensemble->comparer_element, ensemble->copier_element,
+		ensemble->supprimer_element
+	);
+}
+
+/*
+ * Fait passer un ensemble représenté par des bits sur un arbre AVL.
+ */
+static void convertir_en_table( Ensemble* ensemble ){
+	Table* table = creer_table_ensemble( ensemble );
+	for( size_t i = 0; i < ensemble->nb_mots; i++ ){
+		uint64_t mot = ensemble->mots[i];
+		while( mot ){
+			int bit = __builtin_ctzll( mot );
+			add_table( table, (intptr_t) ( i * BITS_PAR_MOT + bit ), 0 );
+			mot &= mot - 1;
+		}
+	}
+	liberer_mots( ensemble );
+	ensemble->taille = 0;
+	ensemble->table = table;
+}
+
+static size_t compter_bits( const uint64_t* mots, size_t n ){
+	size_t res = 0;
+	for( size_t i = 0; i < n; i++ ){
+		res += __builtin_popcountll( mots[i] );
+	}
+	return res;
+}
+
+/*
+ * Opérations mot à mot entre deux tableaux de bits, vectorisées quand le
+ * compilateur cible AVX2 ou SSE2.
+ */
+#if defined(__AVX2__)
+#define OPERATION_MOTS( nom, op_vecteur, op_mot ) \
+	static void nom( uint64_t* dest, const uint64_t* src, size_t n ){ \
+		size_t i = 0; \
+		for( ; i + 4 <= n; i += 4 ){ \
+			__m256i a = _mm256_loadu_si256( (const __m256i*) ( dest + i ) ); \
+			__m256i b = _mm256_loadu_si256( (const __m256i*) ( src + i ) ); \
+			_mm256_storeu_si256( \
+				(__m256i*) ( dest + i ), _mm256_##op_vecteur##_si256( b, a ) \
+			); \
+		} \
+		for( ; i < n; i++ ) dest[i] = op_mot( dest[i], src[i] ); \
+	}
+#elif defined(__SSE2__)
+#define OPERATION_MOTS( nom, op_vecteur, op_mot ) \
+	static void nom( uint64_t* dest, const uint64_t* src, size_t n ){ \
+		size_t i = 0; \
+		for( ; i + 2 <= n; i += 2 ){ \
+			__m128i a = _mm_loadu_si128( (const __m128i*) ( dest + i ) ); \
+			__m128i b = _mm_loadu_si128( (const __m128i*) ( src + i ) ); \
+			_mm_storeu_si128( \
+				(__m128i*) ( dest + i ), _mm_##op_vecteur##_si128( b, a ) \
+			); \
+		} \
+		for( ; i < n; i++ ) dest[i] = op_mot( dest[i], src[i] ); \
+	}
+#else
+#define OPERATION_MOTS( nom, op_vecteur, op_mot ) \
+	static void nom( uint64_t* dest, const uint64_t* src, size_t n ){ \
+		for( size_t i = 0; i < n; i++ ) dest[i] = op_mot( dest[i], src[i] ); \
+	}
+#endif
+
+#define OU_MOT( a, b ) ( (a) | (b) )
+#define ET_MOT( a, b ) ( (a) & (b) )
+#define ET_NON_MOT( a, b ) ( (a) & ~(b) )
+
+/* Les intrinsèques andnot calculent ~b & a : on leur passe (src, dest). */
+OPERATION_MOTS( ou_mots, or, OU_MOT )
+OPERATION_MOTS( et_mots, and, ET_MOT )
+OPERATION_MOTS( et_non_mots, andnot, ET_NON_MOT )
+
+/*
+ * Renvoie le plus petit élément supérieur ou égal à 'debut', -1 s'il 
+ * n'existe pas.
+ */
+static intptr_t bit_suivant( const Ensemble* ensemble, intptr_t debut ){
+	if( debut < 0 ) debut = 0;
+	size_t i = debut / BITS_PAR_MOT;
+	if( i >= ensemble->nb_mots ) return -1;
+	uint64_t mot = ensemble->mots[i] & ( ~(uint64_t) 0 << ( debut % BITS_PAR_MOT ) );
+	while( ! mot ){
+		if( ++i >= ensemble->nb_mots ) return -1;
+		mot = ensemble->mots[i];
+	}
+	return i * BITS_PAR_MOT + __builtin_ctzll( mot );
+}
+
+/*
+ * Renvoie le plus grand élément inférieur ou égal à 'fin', -1 s'il 
+ * n'existe pas.
+ */
+static intptr_t bit_precedent( const Ensemble* ensemble, intptr_t fin ){
+	if( fin < 0 || ensemble->nb_mots == 0 ) return -1;
+	size_t i = fin / BITS_PAR_MOT;
+	uint64_t mot;
+	if( i >= ensemble->nb_mots ){
+		i = ensemble->nb_mots - 1;
+		mot = ensemble->mots[i];
+	}else{
+		int decalage = BITS_PAR_MOT - 1 - fin % BITS_PAR_MOT;
+		mot = ensemble->mots[i] & ( ~(uint64_t) 0 >> decalage );
+	}
+	while( ! mot ){
+		if( i-- == 0 ) return -1;
+		mot = ensemble->mots[i];
+	}
+	return i * BITS_PAR_MOT + BITS_PAR_MOT - 1 - __builtin_clzll( mot );
+}
+
+static int comparer_bitsets( const Ensemble* ens1, const Ensemble* ens2 ){
+	size_t n = ens1->nb_mots > ens2->nb_mots ? ens1->nb_mots : ens2->nb_mots;
+	for( size_t i = 0; i < n; i++ ){
+		uint64_t m1 = i < ens1->nb_mots ? ens1->mots[i] : 0;
+		uint64_t m2 = i < ens2->nb_mots ? ens2->mots[i] : 0;
+		if( m1 == m2 ) continue;
+		/* 
+		 * p est le plus petit élément présent dans un seul des deux 
+		 * ensembles. Celui qui le contient est le plus petit, sauf si 
+		 * l'autre n'a plus d'élément au-delà de p.
+		 */
+		intptr_t p = i * BITS_PAR_MOT + __builtin_ctzll( m1 ^ m2 );
+		if( est_dans_l_ensemble( ens1, p ) ){
+			return ( bit_suivant( ens2, p+1 ) >= 0 ) ? -1 : 1;
+		}
+		return ( bit_suivant( ens1, p+1 ) >= 0 ) ? 1 : -1;
+	}
+	return 0;
+}
+
+void next_iterators( Ensemble_iterateur * it1, Ensemble_iterateur * it2 ){
+	*it1 = iterateur_suivant_ensemble(*it1);
+	*it2 = iterateur_suivant_ensemble(*it2);
 }
 
 int comparer_ensemble( const Ensemble* ens1, const Ensemble*  ens2 ){
-	Table_iterateur it1, it2;
+	Ensemble_iterateur it1, it2;
 	
-	it1 = premier_iterateur_table( ens1->table );
-	it2 = premier_iterateur_table( ens2->table );
+	if( est_bitset( ens1 ) && est_bitset( ens2 ) ){
+		return comparer_bitsets( ens1, ens2 );
+	}
+	it1 = premier_iterateur_ensemble( ens1 );
+	it2 = premier_iterateur_ensemble( ens2 );
 	for( 
 		;
-		( ! iterateur_est_vide(it1) ) && ( ! iterateur_est_vide(it2) );
+		( ! iterateur_ensemble_est_vide(it1) ) && 
+		( ! iterateur_ensemble_est_vide(it2) );
 		next_iterators( &it1, &it2 )
 	){
 		int cmp;
 		if( ens1->comparer_element ){
-			cmp = ens1->comparer_element( get_cle( it1 ), get_cle( it2 ) );
+			cmp = ens1->comparer_element( get_element( it1 ), get_element( it2 ) );
 		}else{
-			cmp = get_cle( it1 ) -  get_cle( it2 );
+			cmp = get_element( it1 ) -  get_element( it2 );
 		}
 	 	if( cmp > 0 ) return 1;
 	 	if( cmp < 0 ) return -1;
 	}
-	if( iterateur_est_vide(it1) && iterateur_est_vide(it2) )
+	if( iterateur_ensemble_est_vide(it1) && iterateur_ensemble_est_vide(it2) )
 		return 0;
-	if( iterateur_est_vide(it1) ) 
+	if( iterateur_ensemble_est_vide(it1) ) 
 		return -1;
 	return 1;
 }
 
+static void initialiser_ensemble(
+	Ensemble * ensemble, Pool* pool,
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)(intptr_t elem )
+){
+	ensemble->pool = pool;
+	ensemble->comparer_element = comparer_element;
+	ensemble->copier_element = copier_element;
+	ensemble->supprimer_element = supprimer_element;
+	ensemble->mots = NULL;
+	ensemble->nb_mots = 0;
+	ensemble->taille = 0;
+	if( comparer_element || copier_element || supprimer_element ){
+		ensemble->table = creer_table_ensemble( ensemble );
+	}else{
+		ensemble->table = NULL;
+	}
+}
 
 Ensemble * creer_ensemble(
 	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
@@ -77,23 +334,223 @@ Ensemble * creer_ensemble(
 	void (*supprimer_element)(intptr_t elem )
 ){
 	Ensemble * result = (Ensemble*) xmalloc( sizeof(Ensemble) );
-	result->table = creer_table(
-		comparer_element, copier_element, supprimer_element
+	initialiser_ensemble(
+		result, NULL, comparer_element, copier_element, supprimer_element
+	);
+	return result;
+}
+
+Ensemble * creer_ensemble_dans_pool(
+	Pool* pool,
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)(intptr_t elem )
+){
+	Ensemble * result = (Ensemble*) allouer_pool( pool, sizeof(Ensemble) );
+	initialiser_ensemble(
+		result, pool, comparer_element, copier_element, supprimer_element
 	);
-	result->comparer_element = comparer_element;
-	result->copier_element = copier_element;
-	result->supprimer_element = supprimer_element;
 	return result;
 }
 
 void liberer_ensemble( Ensemble * ens ){
 	if(ens){
-		liberer_table( ens->table );
-		xfree( ens );
+		if( ens->table ){
+			liberer_table( ens->table );
+		}
+		liberer_mots( ens );
+		if( ens->pool ){
+			rendre_pool( ens->pool, ens, sizeof(Ensemble) );
+		}else{
+			xfree( ens );
+		}
+	}
+}
+
+/*
+ * Opérations ensemblistes par fusion.
+ *
+ * Les éléments d'un ensemble sont parcourus dans l'ordre croissant : on
+ * obtient l'union, l'intersection ou la différence de deux ensembles de 
+ * tailles n et m en O(n+m) en fusionnant leurs listes triées, puis on 
+ * construit directement l'arbre équilibré du résultat (voir 
+ * remplir_table_triee()).
+ */
+typedef enum {
+	OPERATION_UNION, OPERATION_INTERSECTION, OPERATION_DIFFERENCE
+} Operation_ensemble;
+
+static int comparer_elements(
+	const Ensemble* ensemble, const intptr_t a, const intptr_t b
+){
+	if( ensemble->comparer_element ){
+		return ensemble->comparer_element( a, b );
+	}
+	if( a < b ) return -1;
+	if( a > b ) return 1;
+	return 0;
+}
+
+static void action_elements_tries( const intptr_t element, void* data ){
+	intptr_t** fin = (intptr_t**) data;
+	*( (*fin)++ ) = element;
+}
+
+/*
+ * Écrit les éléments de l'ensemble dans le tableau, par ordre croissant. 
+ * Renvoie le nombre d'éléments écrits.
+ */
+static size_t elements_tries( const Ensemble* ensemble, intptr_t* elements ){
+	intptr_t* fin = elements;
+	pour_tout_element( ensemble, action_elements_tries, &fin );
+	return fin - elements;
+}
+
+/*
+ * Fusionne deux tableaux triés selon l'opération demandée. 'res' doit 
+ * pouvoir contenir n1+n2 éléments. Renvoie le nombre d'éléments de 'res'.
+ */
+static size_t fusionner(
+	const Ensemble* ensemble, Operation_ensemble operation,
+	const intptr_t* t1, size_t n1, const intptr_t* t2, size_t n2,
+	intptr_t* res
+){
+	size_t i = 0, j = 0, k = 0;
+	while( i < n1 && j < n2 ){
+		int cmp = comparer_elements( ensemble, t1[i], t2[j] );
+		if( cmp < 0 ){
+			if( operation != OPERATION_INTERSECTION ) res[k++] = t1[i];
+			i++;
+		}else if( cmp > 0 ){
+			if( operation == OPERATION_UNION ) res[k++] = t2[j];
+			j++;
+		}else{
+			if( operation != OPERATION_DIFFERENCE ) res[k++] = t1[i];
+			i++;
+			j++;
+		}
+	}
+	if( operation != OPERATION_INTERSECTION ){
+		while( i < n1 ) res[k++] = t1[i++];
+	}
+	if( operation == OPERATION_UNION ){
+		while( j < n2 ) res[k++] = t2[j++];
+	}
+	return k;
+}
+
+/*
+ * Remplit un ensemble vide avec des éléments triés. Un ensemble d'entiers 
+ * garde sa représentation par bits si les éléments s'y prêtent.
+ */
+static void remplir_ensemble_trie(
+	Ensemble* ensemble, const intptr_t* elements, size_t nb
+){
+	if( nb == 0 ) return;
+	if( est_bitset( ensemble ) ){
+		if( 
+			elements[0] >= 0 && bitset_suffisamment_dense(
+				elements[nb-1] / BITS_PAR_MOT + 1, nb - 1
+			)
+		){
+			agrandir_mots( ensemble, elements[nb-1] / BITS_PAR_MOT + 1 );
+			for( size_t i = 0; i < nb; i++ ){
+				ensemble->mots[ elements[i] / BITS_PAR_MOT ] |= 
+					(uint64_t) 1 << ( elements[i] % BITS_PAR_MOT );
+			}
+			ensemble->taille = nb;
+			return;
+		}
+		liberer_mots( ensemble );
+		ensemble->taille = 0;
+		ensemble->table = creer_table_ensemble( ensemble );
+	}
+	remplir_table_triee( ensemble->table, elements, NULL, nb );
+}
+
+/*
+ * Remplace le contenu d'un ensemble par des éléments triés. Les éléments
+ * peuvent provenir de l'ensemble lui-même : ils sont copiés avant que 
+ * l'ancien contenu ne soit supprimé.
+ */
+static void remplacer_elements(
+	Ensemble* ensemble, const intptr_t* elements, size_t nb
+){
+	if( est_bitset( ensemble ) ){
+		vider_ensemble( ensemble );
+		remplir_ensemble_trie( ensemble, elements, nb );
+		return;
 	}
+	Table* ancienne = ensemble->table;
+	ensemble->table = creer_table_ensemble( ensemble );
+	remplir_table_triee( ensemble->table, elements, NULL, nb );
+	liberer_table( ancienne );
+}
+
+/*
+ * Calcule 'ens1 operation ens2' dans un tableau trié alloué par la fonction.
+ */
+static intptr_t* elements_operation(
+	const Ensemble* ens1, const Ensemble* ens2, Operation_ensemble operation,
+	size_t* nb
+){
+	size_t n1 = taille_ensemble( ens1 );
+	size_t n2 = taille_ensemble( ens2 );
+	intptr_t* t = (intptr_t*) xmalloc( ( 2 * ( n1 + n2 ) + 1 ) * sizeof(intptr_t) );
+	intptr_t* t1 = t + n1 + n2;
+	intptr_t* t2 = t1 + n1;
+	elements_tries( ens1, t1 );
+	elements_tries( ens2, t2 );
+	*nb = fusionner( ens1, operation, t1, n1, t2, n2, t );
+	return t;
+}
+
+static Ensemble* creer_operation_ensemble(
+	const Ensemble* ens1, const Ensemble* ens2, Operation_ensemble operation
+){
+	size_t nb;
+	intptr_t* elements = elements_operation( ens1, ens2, operation, &nb );
+	Ensemble* res = creer_ensemble(
+		ens1->comparer_element, ens1->copier_element, ens1->supprimer_element
+	);
+	remplir_ensemble_trie( res, elements, nb );
+	xfree( elements );
+	return res;
+}
+
+static void operation_dans(
+	Ensemble* ens1, const Ensemble* ens2, Operation_ensemble operation
+){
+	size_t nb;
+	intptr_t* elements = elements_operation( ens1, ens2, operation, &nb );
+	remplacer_elements( ens1, elements, nb );
+	xfree( elements );
+}
+
+/*
+ * Renvoie vrai si traiter un à un 'petit' éléments dans un ensemble de 
+ * 'grand' éléments (O(petit log grand)) coûte moins cher qu'une fusion.
+ */
+static int preferer_element_par_element( size_t petit, size_t grand ){
+	size_t log = 1;
+	while( grand >> log ) log++;
+	return petit * log < petit + grand;
 }
 
 void ajouter_element( Ensemble * ensemble, const intptr_t element ){
+	if( est_bitset( ensemble ) ){
+		if( bitset_accepte( ensemble, element ) ){
+			size_t i = element / BITS_PAR_MOT;
+			uint64_t bit = (uint64_t) 1 << ( element % BITS_PAR_MOT );
+			agrandir_mots( ensemble, i+1 );
+			if( ! ( ensemble->mots[i] & bit ) ){
+				ensemble->mots[i] |= bit;
+				ensemble->taille++;
+			}
+			return;
+		}
+		convertir_en_table( ensemble );
+	}
 	add_table( ensemble->table, element, (intptr_t) NULL );
 }
 
@@ -102,8 +559,30 @@ void action_ajouter_element( const intptr_t element, void* ens ){
 	ajouter_element( (Ensemble*) ens, element );
 }
 
+void union_dans( Ensemble * ens1, const Ensemble * ens2 ){
+	if( est_bitset( ens1 ) && est_bitset( ens2 ) ){
+		size_t n = mots_utilises( ens2 );
+		size_t taille = ens1->taille > ens2->taille ? ens1->taille : ens2->taille;
+		if( bitset_suffisamment_dense( n, taille ) ){
+			agrandir_mots( ens1, n );
+			ou_mots( ens1->mots, ens2->mots, n );
+			ens1->taille = compter_bits( ens1->mots, ens1->nb_mots );
+			return;
+		}
+	}
+	if( 
+		est_bitset( ens1 ) || preferer_element_par_element(
+			taille_ensemble( ens2 ), taille_ensemble( ens1 )
+		)
+	){
+		pour_tout_element( ens2, action_ajouter_element, ens1 );
+		return;
+	}
+	operation_dans( ens1, ens2, OPERATION_UNION );
+}
+
 void ajouter_elements( Ensemble * ens1, const Ensemble * ens2 ){
-	pour_tout_element( ens2, action_ajouter_element, ens1 );
+	union_dans( ens1, ens2 );
 }
 
 void transferer_elements_et_libere(
@@ -121,6 +600,14 @@ void transferer_elements(
 }
 
 void retirer_element( Ensemble * ensemble, const intptr_t element ){
+	if( est_bitset( ensemble ) ){
+		if( est_dans_l_ensemble( ensemble, element ) ){
+			ensemble->mots[ element / BITS_PAR_MOT ] &= 
+				~( (uint64_t) 1 << ( element % BITS_PAR_MOT ) );
+			ensemble->taille--;
+		}
+		return;
+	}
 	delete_table( ensemble->table, element );
 }
 
@@ -129,26 +616,96 @@ void action_retirer_elements( const intptr_t element, void* ens ){
 }
 
 void retirer_elements( Ensemble * ens1, const Ensemble * ens2 ){
-	pour_tout_element( ens2, action_retirer_elements, ens1 );
+	if( est_bitset( ens1 ) && est_bitset( ens2 ) ){
+		size_t n = ens1->nb_mots < ens2->nb_mots ? ens1->nb_mots : ens2->nb_mots;
+		et_non_mots( ens1->mots, ens2->mots, n );
+		ens1->taille = compter_bits( ens1->mots, ens1->nb_mots );
+		return;
+	}
+	if( 
+		est_bitset( ens1 ) || preferer_element_par_element(
+			taille_ensemble( ens2 ), taille_ensemble( ens1 )
+		)
+	){
+		pour_tout_element( ens2, action_retirer_elements, ens1 );
+		return;
+	}
+	operation_dans( ens1, ens2, OPERATION_DIFFERENCE );
 }
 
-void vider_ensemble( Ensemble * ensemble ){
-	vider_table( ensemble->table );
+void action_retenir_absents( const intptr_t element, void* data ){
+	void** info = (void**) data;
+	const Ensemble* ens2 = (const Ensemble*) info[0];
+	intptr_t** fin = (intptr_t**) info[1];
+	if( ! est_dans_l_ensemble( ens2, element ) ){
+		*( (*fin)++ ) = element;
+	}
 }
 
-int est_dans_l_ensemble( const Ensemble * ensemble, intptr_t element ){
-	Table_iterateur it = trouver_table( ensemble->table, element );
-	return ! avl_t_is_null( &it ); 
+void intersection_dans( Ensemble * ens1, const Ensemble * ens2 ){
+	if( est_bitset( ens1 ) && est_bitset( ens2 ) ){
+		size_t n = ens1->nb_mots < ens2->nb_mots ? ens1->nb_mots : ens2->nb_mots;
+		et_mots( ens1->mots, ens2->mots, n );
+		if( ens1->nb_mots > n ){
+			memset( ens1->mots + n, 0, ( ens1->nb_mots - n ) * sizeof(uint64_t) );
+		}
+		ens1->taille = compter_bits( ens1->mots, n );
+		return;
+	}
+	size_t n1 = taille_ensemble( ens1 );
+	if( 
+		est_bitset( ens1 ) || 
+		preferer_element_par_element( n1, taille_ensemble( ens2 ) ) 
+	){
+		// On ne peut pas retirer pendant le parcours : on note les absents.
+		intptr_t* absents = (intptr_t*) xmalloc( ( n1 + 1 ) * sizeof(intptr_t) );
+		intptr_t* fin = absents;
+		void* data[2] = { (void*) ens2, (void*) &fin };
+		pour_tout_element( ens1, action_retenir_absents, data );
+		for( intptr_t* e = absents; e < fin; e++ ){
+			retirer_element( ens1, *e );
+		}
+		xfree( absents );
+		return;
+	}
+	operation_dans( ens1, ens2, OPERATION_INTERSECTION );
 }
 
-void action_taille_ensemble( const intptr_t element, void* taille ){
-	(*(int*) taille)+=1;
+void vider_ensemble( Ensemble * ensemble ){
+	if( est_bitset( ensemble ) ){
+		if( ensemble->mots ){
+			memset( ensemble->mots, 0, ensemble->nb_mots * sizeof(uint64_t) );
+		}
+		ensemble->taille = 0;
+	}else if( 
+		ensemble->comparer_element || ensemble->copier_element || 
+		ensemble->supprimer_element
+	){
+		vider_table( ensemble->table );
+	}else{
+		/* Un ensemble d'entiers vidé revient à la représentation par bits. */
+		liberer_table( ensemble->table );
+		ensemble->table = NULL;
+	}
+}
+
+int est_dans_l_ensemble( const Ensemble * ensemble, intptr_t element ){
+	if( est_bitset( ensemble ) ){
+		if( element < 0 || element / BITS_PAR_MOT >= ensemble->nb_mots ){
+			return 0;
+		}
+		return ( 
+			ensemble->mots[ element / BITS_PAR_MOT ] >> ( element % BITS_PAR_MOT )
+		) & 1;
+	}
+	return trouver_valeur_table( ensemble->table, element, NULL );
 }
 
 unsigned int taille_ensemble( const Ensemble* ensemble ){
-	int taille = 0;
-	pour_tout_element( ensemble, action_taille_ensemble, &taille );
-	return taille;
+	if( est_bitset( ensemble ) ){
+		return ensemble->taille;
+	}
+	return taille_table( ensemble->table );
 }
 
 typedef struct {
@@ -193,6 +750,17 @@ void pour_tout_element(
 	void (* action )( const intptr_t element, void* data ),
 	void* data
 ){
+	if( est_bitset( ensemble ) ){
+		for( size_t i = 0; i < ensemble->nb_mots; i++ ){
+			uint64_t mot = ensemble->mots[i];
+			while( mot ){
+				int bit = __builtin_ctzll( mot );
+				action( (intptr_t) ( i * BITS_PAR_MOT + bit ), data );
+				mot &= mot - 1;
+			}
+		}
+		return;
+	}
 	data_pour_tout_element_t data1;
 	data1.action = action;
 	data1.data = data;
@@ -202,9 +770,15 @@ void pour_tout_element(
 }
 
 void swap_ensemble( Ensemble* ens1, Ensemble* ens2 ){
-	void* tmp = ens1->table;
+	Ensemble tmp = *ens1;
 	ens1->table = ens2->table;
-	ens2->table = tmp;
+	ens1->mots = ens2->mots;
+	ens1->nb_mots = ens2->nb_mots;
+	ens1->taille = ens2->taille;
+	ens2->table = tmp.table;
+	ens2->mots = tmp.mots;
+	ens2->nb_mots = tmp.nb_mots;
+	ens2->taille = tmp.taille;
 }
 void deplacer_ensemble( Ensemble* ens1, Ensemble* ens2 ){
 	swap_ensemble( ens1, ens2 );
@@ -216,58 +790,125 @@ Ensemble* copier_ensemble( const Ensemble* ensemble ){
 		ensemble->comparer_element, ensemble->copier_element,
 		ensemble->supprimer_element
 	);
-	ajouter_elements( res, ensemble  );
+	if( est_bitset( ensemble ) ){
+		size_t n = mots_utilises( ensemble );
+		if( n ){
+			res->mots = allouer_mots( res, n );
+			res->nb_mots = n;
+			memcpy( res->mots, ensemble->mots, n * sizeof(uint64_t) );
+			res->taille = ensemble->taille;
+		}
+		return res;
+	}
+	intptr_t* elements = (intptr_t*) xmalloc(
+		( taille_ensemble( ensemble ) + 1 ) * sizeof(intptr_t)
+	);
+	remplir_ensemble_trie( res, elements, elements_tries( ensemble, elements ) );
+	xfree( elements );
 	return res;
 }
 
 Ensemble * creer_union_ensemble( const Ensemble* ens1, const Ensemble* ens2 ){
-	Ensemble * res = copier_ensemble( ens1 );
-	ajouter_elements( res, ens2 );
-	return res;
+	if( est_bitset( ens1 ) && est_bitset( ens2 ) ){
+		Ensemble * res = copier_ensemble( ens1 );
+		union_dans( res, ens2 );
+		return res;
+	}
+	return creer_operation_ensemble( ens1, ens2, OPERATION_UNION );
 }
 
 Ensemble * creer_difference_ensemble(
 	const Ensemble* ens1, const Ensemble* ens2
 ){
-	Ensemble * res = copier_ensemble( ens1 );
-	retirer_elements( res, ens2 );
-	return res;
+	if( est_bitset( ens1 ) && est_bitset( ens2 ) ){
+		Ensemble * res = copier_ensemble( ens1 );
+		retirer_elements( res, ens2 );
+		return res;
+	}
+	return creer_operation_ensemble( ens1, ens2, OPERATION_DIFFERENCE );
 }
 
 Ensemble * creer_intersection_ensemble(
 	const Ensemble* ens1, const Ensemble* ens2
 ){
-	Ensemble *tmp, *res;
-	tmp = creer_difference_ensemble( ens1, ens2 );
-	res = creer_difference_ensemble( ens1, tmp );
-	liberer_ensemble( tmp );
-	return res;
+	if( est_bitset( ens1 ) && est_bitset( ens2 ) ){
+		Ensemble * res = copier_ensemble( ens1 );
+		intersection_dans( res, ens2 );
+		return res;
+	}
+	return creer_operation_ensemble( ens1, ens2, OPERATION_INTERSECTION );
+}
+
+static Ensemble_iterateur iterateur_bitset(
+	const Ensemble* ensemble, intptr_t element
+){
+	Ensemble_iterateur it;
+	it.bitset = ensemble;
+	it.element = element;
+	return it;
+}
+
+static Ensemble_iterateur iterateur_avl( Table_iterateur avl ){
+	Ensemble_iterateur it;
+	it.avl = avl;
+	it.bitset = NULL;
+	it.element = -1;
+	return it;
 }
 
 Ensemble_iterateur trouver_ensemble(
 	const Ensemble* ensemble, const intptr_t element
 ){
-	return trouver_table( ensemble->table, element );
+	if( est_bitset( ensemble ) ){
+		return iterateur_bitset( 
+			ensemble, est_dans_l_ensemble( ensemble, element ) ? element : -1
+		);
+	}
+	return iterateur_avl( trouver_table( ensemble->table, element ) );
 }
 
 Ensemble_iterateur premier_iterateur_ensemble( const Ensemble* ensemble ){
-	return premier_iterateur_table( ensemble->table );
+	if( est_bitset( ensemble ) ){
+		return iterateur_bitset( ensemble, bit_suivant( ensemble, 0 ) );
+	}
+	return iterateur_avl( premier_iterateur_table( ensemble->table ) );
 }
 
+/*
+ * Comme pour les arbres AVL, le suivant de l'itérateur vide est le premier
+ * élément et son précédent est le dernier.
+ */
 Ensemble_iterateur iterateur_suivant_ensemble(
 	const Ensemble_iterateur iterateur
 ){
-	return iterateur_suivant_table( iterateur );
+	if( iterateur.bitset ){
+		return iterateur_bitset(
+			iterateur.bitset, bit_suivant( iterateur.bitset, iterateur.element + 1 )
+		);
+	}
+	return iterateur_avl( iterateur_suivant_table( iterateur.avl ) );
 }
 
 Ensemble_iterateur iterateur_precedent_ensemble( Ensemble_iterateur iterateur ){
-	return iterateur_precedent_table( iterateur );
+	if( iterateur.bitset ){
+		intptr_t fin = iterateur.element < 0 ? INTPTR_MAX : iterateur.element - 1;
+		return iterateur_bitset(
+			iterateur.bitset, bit_precedent( iterateur.bitset, fin )
+		);
+	}
+	return iterateur_avl( iterateur_precedent_table( iterateur.avl ) );
 }
 
 int iterateur_ensemble_est_vide( Ensemble_iterateur iterateur ){
-	return iterateur_est_vide( iterateur );
+	if( iterateur.bitset ){
+		return iterateur.element < 0;
+	}
+	return iterateur_est_vide( iterateur.avl );
 }
 
 intptr_t get_element( Ensemble_iterateur it ){
-	return get_cle( it );
+	if( it.bitset ){
+		return it.element;
+	}
+	return get_cle( it.avl );
 }
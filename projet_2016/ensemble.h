@@ -25,13 +25,27 @@
 #include <stdint.h>
 
 #include "avl.h"
+#include "pool.h"
 #include "table.h"
 
 /*
  * Définit le type d'un ensemble.
+ *
+ * Un ensemble d'entiers sans fonctions de comparaison, de copie et de 
+ * suppression est représenté par un tableau de bits ('mots') : l'élément 
+ * i est présent si le bit i est à 1. Dans ce cas, 'table' vaut NULL et 
+ * 'taille' contient le nombre d'éléments.
+ *
+ * Dès que l'ensemble reçoit un élément négatif ou trop grand par rapport 
+ * à son nombre d'éléments, il bascule sur un arbre AVL ('table') et y reste 
+ * jusqu'à ce qu'il soit vidé. Les autres ensembles utilisent toujours l'arbre.
  */
 struct Ensemble {
 	Table* table;
+	uint64_t* mots;
+	size_t nb_mots;
+	size_t taille;
+	Pool* pool;
 	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 );
 	intptr_t (*copier_element)( const intptr_t elem );
 	void (*supprimer_element)(intptr_t elem );
@@ -41,8 +55,16 @@ typedef struct Ensemble Ensemble;
 
 /*
  * Définit le type d'un itérateur sur les éléments d'un ensemble.
+ *
+ * Pour un ensemble représenté par un tableau de bits, 'bitset' pointe sur 
+ * l'ensemble et 'element' contient l'élément courant (-1 pour l'itérateur 
+ * vide). Sinon, 'bitset' vaut NULL et seul 'avl' est utilisé.
  */
-typedef struct avl_traverser Ensemble_iterateur;
+typedef struct {
+	struct avl_traverser avl;
+	const Ensemble* bitset;
+	intptr_t element;
+} Ensemble_iterateur;
 
 /*
  * Renvoie un nouvel ensemble vide.
@@ -64,6 +86,22 @@ Ensemble * creer_ensemble(
 	void (*supprimer_element)( intptr_t elem )
 );
 
+/*
+ * Renvoie un nouvel ensemble vide dont toute la mémoire est prise dans le pool
+ * passé en paramètre (voir creer_table_dans_pool()).
+ *
+ * L'ensemble peut être libéré par liberer_ensemble() ou disparaître avec le
+ * pool. Dans ce dernier cas, les éléments ne sont pas supprimés un par un : 
+ * cela ne convient donc qu'aux ensembles dont la fonction 
+ * 'supprimer_element' est NULL.
+ */
+Ensemble * creer_ensemble_dans_pool(
+	Pool* pool,
+	int (*comparer_element)( const intptr_t elem1, const intptr_t elem2 ),
+	intptr_t (*copier_element)( const intptr_t elem ),
+	void (*supprimer_element)( intptr_t elem )
+);
+
 /*
  * Libère la mémoire d'un ensemble.
  * La mémoire de tous les éléments de l'ensemble est aussi libérée.
@@ -82,9 +120,26 @@ void ajouter_element( Ensemble * ensemble, const intptr_t  element );
 
 /*
  * Ajoute tous les éléments d'un ensemble à un ensemble.
+ * C'est la même opération que union_dans().
  */
 void ajouter_elements( Ensemble * ens1, const Ensemble * ens2 );
 
+/*
+ * Remplace ens1 par l'union de ens1 et de ens2, sans créer de nouvel 
+ * ensemble.
+ *
+ * Si ens2 est petit devant ens1, ses éléments sont ajoutés un par un. Sinon,
+ * les deux ensembles sont fusionnés en O(n+m) et l'arbre de ens1 est 
+ * reconstruit.
+ */
+void union_dans( Ensemble * ens1, const Ensemble * ens2 );
+
+/*
+ * Remplace ens1 par l'intersection de ens1 et de ens2, sans créer de nouvel
+ * ensemble.
+ */
+void intersection_dans( Ensemble * ens1, const Ensemble * ens2 );
+
 /*
  * Transfère tous les élément de l'ensemble source dans l'ensemble destination
  * La mémoire de l'ensemble source n'est pas libérer.
@@ -108,7 +163,9 @@ void transferer_elements_et_libere( Ensemble * destination, Ensemble * source );
 void retirer_element( Ensemble * ensemble, const intptr_t element );
 
 /*
- * Retire tous les éléments d'un ensemble
+ * Retire tous les éléments d'un ensemble.
+ * Comme union_dans(), procède élément par élément ou par fusion selon les 
+ * tailles des deux ensembles.
  */
 void retirer_elements( Ensemble * ens1, const Ensemble * ens2 );
 
@@ -186,6 +243,10 @@ void print_ensemble(
 
 /*
  * Échange le contenu de deux ensembles passés en paramètre.
+ *
+ * Le contenu garde sa provenance : échanger un ensemble pris dans un pool
+ * avec un ensemble alloué normalement n'est sûr que si les deux ensembles
+ * sont ensuite libérés par liberer_ensemble().
  */
 void swap_ensemble( Ensemble* ens1, Ensemble* ens2 );
 
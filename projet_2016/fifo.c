@@ -22,62 +22,277 @@
 #include "outils.h"
 #include "fifo.h"
 
-typedef struct List List;
+#include <stdatomic.h>
+#include <string.h>
 
-struct List {
-	List * next;
-	intptr_t element;
-};
+#define CAPACITE_INITIALE 16
 
+/*
+ * Les éléments de la file sont elements[debut], elements[debut+1], ...,
+ * les indices étant pris modulo la capacité, qui est une puissance de 2.
+ */
 struct Fifo {
-	List * list;
+	intptr_t * elements;
+	size_t capacite;
+	size_t debut;
+	size_t taille;
 };
 
-List* allouer_list( List * next, intptr_t element ){
-	List* res = (List*) xmalloc( sizeof(List) );
-	res->next = next;
-	res->element = element;
+Fifo* creer_fifo(){
+	Fifo* res = xmalloc( sizeof(Fifo) );
+	res->capacite = CAPACITE_INITIALE;
+	res->elements = xmalloc( res->capacite * sizeof(intptr_t) );
+	res->debut = 0;
+	res->taille = 0;
 	return res;
 }
 
-void liberer_list( List * list ){
-	xfree( list );
+void liberer_fifo( Fifo* fifo ){
+	xfree( fifo->elements );
+	xfree( fifo );
+}
+
+int est_vide( Fifo* fifo ){
+	return fifo->taille == 0;
+}
+
+size_t taille_fifo( const Fifo* fifo ){
+	return fifo->taille;
+}
+
+/*
+ * Agrandit le tableau pour qu'il contienne au moins 'taille' éléments. La
+ * partie de la file qui faisait le tour du tableau est recopiée après 
+ * l'ancienne fin, pour que les éléments restent consécutifs modulo la 
+ * nouvelle capacité.
+ */
+static void reserver_fifo( Fifo* fifo, size_t taille ){
+	if( taille <= fifo->capacite ){
+		return;
+	}
+	size_t capacite = fifo->capacite;
+	while( capacite < taille ){
+		capacite *= 2;
+	}
+	fifo->elements = xrealloc( fifo->elements, capacite * sizeof(intptr_t) );
+	if( fifo->debut + fifo->taille > fifo->capacite ){
+		memcpy( 
+			fifo->elements + fifo->capacite, fifo->elements, 
+			( fifo->debut + fifo->taille - fifo->capacite ) * sizeof(intptr_t)
+		);
+	}
+	fifo->capacite = capacite;
 }
 
 void ajouter_fifo( Fifo* fifo, intptr_t element ){
-	fifo->list = allouer_list( fifo->list, element );
+	reserver_fifo( fifo, fifo->taille + 1 );
+	fifo->elements[ 
+		( fifo->debut + fifo->taille ) & ( fifo->capacite - 1 ) 
+	] = element;
+	fifo->taille++;
+}
+
+void ajouter_elements_fifo( Fifo* fifo, const intptr_t* elements, size_t nb ){
+	reserver_fifo( fifo, fifo->taille + nb );
+	size_t fin = ( fifo->debut + fifo->taille ) & ( fifo->capacite - 1 );
+	size_t premier = fifo->capacite - fin;
+	if( premier > nb ){
+		premier = nb;
+	}
+	memcpy( fifo->elements + fin, elements, premier * sizeof(intptr_t) );
+	memcpy( 
+		fifo->elements, elements + premier, ( nb - premier ) * sizeof(intptr_t)
+	);
+	fifo->taille += nb;
 }
 
 intptr_t retirer_fifo( Fifo* fifo ){
-	intptr_t res = fifo->list->element;
-	List* tmp = fifo->list;
-	fifo->list = fifo->list->next;
-	liberer_list( tmp );
+	intptr_t res = fifo->elements[ fifo->debut ];
+	fifo->debut = ( fifo->debut + 1 ) & ( fifo->capacite - 1 );
+	fifo->taille--;
 	return res;
 }
 
+size_t retirer_elements_fifo( Fifo* fifo, intptr_t* elements, size_t nb ){
+	if( nb > fifo->taille ){
+		nb = fifo->taille;
+	}
+	size_t premier = fifo->capacite - fifo->debut;
+	if( premier > nb ){
+		premier = nb;
+	}
+	memcpy( elements, fifo->elements + fifo->debut, premier * sizeof(intptr_t) );
+	memcpy( 
+		elements + premier, fifo->elements, ( nb - premier ) * sizeof(intptr_t)
+	);
+	fifo->debut = ( fifo->debut + nb ) & ( fifo->capacite - 1 );
+	fifo->taille -= nb;
+	return nb;
+}
+
 intptr_t obtenir_fifo( Fifo* fifo ){
-	return fifo->list->element;
+	return fifo->elements[ fifo->debut ];
 }
 
-int est_vide( Fifo* fifo ){
-	return fifo->list == NULL;
+
+/*
+ * Tableau circulaire d'une deque. Les cases sont atomiques car un voleur
+ * peut lire une case pendant que le propriétaire en écrit une autre ; les
+ * accès eux-mêmes sont relâchés, l'ordre étant assuré par 'haut' et 'bas'.
+ */
+typedef struct Tableau_deque Tableau_deque;
+
+struct Tableau_deque {
+	Tableau_deque * precedent;
+	int64_t capacite;
+	_Atomic intptr_t elements[];
+};
+
+/*
+ * Les éléments de la deque sont ceux d'indices haut, ..., bas-1 (modulo la
+ * capacité du tableau). 'haut' et 'bas' sont séparés par une ligne de 
+ * cache : le premier est disputé par les voleurs, le second n'est écrit 
+ * que par le propriétaire.
+ */
+struct Deque {
+	_Atomic int64_t haut;
+	char separation[64];
+	_Atomic int64_t bas;
+	_Atomic(Tableau_deque *) tableau;
+};
+
+static Tableau_deque * allouer_tableau_deque( 
+	int64_t capacite, Tableau_deque * precedent 
+){
+	Tableau_deque * res = xmalloc( 
+		sizeof(Tableau_deque) + capacite * sizeof(_Atomic intptr_t) 
+	);
+	res->precedent = precedent;
+	res->capacite = capacite;
+	return res;
 }
 
-Fifo* creer_fifo(){
-	Fifo* res = xmalloc( sizeof(Fifo) );
-	res->list = NULL;
+Deque* creer_deque(){
+	Deque* res = xmalloc( sizeof(Deque) );
+	atomic_init( &res->haut, 0 );
+	atomic_init( &res->bas, 0 );
+	atomic_init( 
+		&res->tableau, allouer_tableau_deque( CAPACITE_INITIALE, NULL ) 
+	);
+	return res;
+}
+
+void liberer_deque( Deque* deque ){
+	Tableau_deque * tableau = atomic_load( &deque->tableau );
+	while( tableau ){
+		Tableau_deque * precedent = tableau->precedent;
+		xfree( tableau );
+		tableau = precedent;
+	}
+	xfree( deque );
+}
+
+/*
+ * Recopie les éléments haut, ..., bas-1 dans un tableau deux fois plus 
+ * grand. L'ancien tableau est gardé dans la chaîne des précédents.
+ */
+static Tableau_deque * agrandir_deque( 
+	Deque* deque, Tableau_deque * tableau, int64_t haut, int64_t bas
+){
+	Tableau_deque * res = allouer_tableau_deque( 
+		2 * tableau->capacite, tableau 
+	);
+	for( int64_t i = haut; i < bas; i++ ){
+		atomic_store_explicit(
+			&res->elements[ i & ( res->capacite - 1 ) ],
+			atomic_load_explicit(
+				&tableau->elements[ i & ( tableau->capacite - 1 ) ],
+				memory_order_relaxed
+			),
+			memory_order_relaxed
+		);
+	}
+	atomic_store_explicit( &deque->tableau, res, memory_order_release );
 	return res;
 }
 
-void vider_list( List * list ){
-	if( list ){
-		vider_list( list->next );
-		xfree( list );
+/*
+ * Les ordres mémoire sont ceux de la version C11 de l'algorithme donnée 
+ * par Lê, Pop, Cohen et Zappa Nardelli (PPoPP 2013).
+ */
+void ajouter_deque( Deque* deque, intptr_t element ){
+	int64_t bas = atomic_load_explicit( &deque->bas, memory_order_relaxed );
+	int64_t haut = atomic_load_explicit( &deque->haut, memory_order_acquire );
+	Tableau_deque * tableau = atomic_load_explicit( 
+		&deque->tableau, memory_order_relaxed 
+	);
+	if( bas - haut > tableau->capacite - 1 ){
+		tableau = agrandir_deque( deque, tableau, haut, bas );
+	}
+	atomic_store_explicit( 
+		&tableau->elements[ bas & ( tableau->capacite - 1 ) ], element,
+		memory_order_relaxed
+	);
+	atomic_thread_fence( memory_order_release );
+	atomic_store_explicit( &deque->bas, bas + 1, memory_order_relaxed );
+}
+
+Etat_deque reprendre_deque( Deque* deque, intptr_t* element ){
+	int64_t bas = 
+		atomic_load_explicit( &deque->bas, memory_order_relaxed ) - 1;
+	Tableau_deque * tableau = atomic_load_explicit( 
+		&deque->tableau, memory_order_relaxed 
+	);
+	atomic_store_explicit( &deque->bas, bas, memory_order_relaxed );
+	atomic_thread_fence( memory_order_seq_cst );
+	int64_t haut = atomic_load_explicit( &deque->haut, memory_order_relaxed );
+	if( haut > bas ){
+		atomic_store_explicit( &deque->bas, bas + 1, memory_order_relaxed );
+		return DEQUE_VIDE;
+	}
+	*element = atomic_load_explicit( 
+		&tableau->elements[ bas & ( tableau->capacite - 1 ) ],
+		memory_order_relaxed
+	);
+	if( haut < bas ){
+		return DEQUE_SUCCES;
+	}
+	/* Dernier élément : on le dispute aux voleurs. */
+	Etat_deque res = DEQUE_SUCCES;
+	if( 
+		! atomic_compare_exchange_strong_explicit(
+			&deque->haut, &haut, haut + 1, 
+			memory_order_seq_cst, memory_order_relaxed
+		)
+	){
+		res = DEQUE_VIDE;
 	}
+	atomic_store_explicit( &deque->bas, bas + 1, memory_order_relaxed );
+	return res;
 }
 
-void liberer_fifo( Fifo* file ){
-	vider_list( file->list );
-	xfree( file );
+Etat_deque voler_deque( Deque* deque, intptr_t* element ){
+	int64_t haut = atomic_load_explicit( &deque->haut, memory_order_acquire );
+	atomic_thread_fence( memory_order_seq_cst );
+	int64_t bas = atomic_load_explicit( &deque->bas, memory_order_acquire );
+	if( haut >= bas ){
+		return DEQUE_VIDE;
+	}
+	Tableau_deque * tableau = atomic_load_explicit( 
+		&deque->tableau, memory_order_acquire 
+	);
+	intptr_t res = atomic_load_explicit( 
+		&tableau->elements[ haut & ( tableau->capacite - 1 ) ],
+		memory_order_relaxed
+	);
+	if( 
+		! atomic_compare_exchange_strong_explicit(
+			&deque->haut, &haut, haut + 1, 
+			memory_order_seq_cst, memory_order_relaxed
+		)
+	){
+		return DEQUE_ABANDON;
+	}
+	*element = res;
+	return DEQUE_SUCCES;
 }
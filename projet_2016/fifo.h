@@ -22,13 +22,18 @@
 #ifndef __FIFO_H__
 #define __FIFO_H__
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*
  * Définit le type d'une file first-in first-out contenant des entiers ou 
- * des pointerus vers des stucture plus complexes.
+ * des pointeurs vers des structures plus complexes.
  * La file n'est pas responsable de la mémoire des éléments qui y sont 
  * entreposés.
+ *
+ * Les éléments sont rangés dans un tableau circulaire dont la capacité 
+ * double quand il est plein : ajouter un élément ne coûte une allocation
+ * qu'en moyenne amortie constante.
  */
 typedef struct Fifo Fifo;
 
@@ -39,7 +44,7 @@ Fifo* creer_fifo();
 
 /*
  * Supprimme la mémoire associée à la file.
- * La mamoir associée aux élément de la file ne sont pas supprimé.
+ * La mémoire associée aux éléments de la file n'est pas supprimée.
  */
 void liberer_fifo( Fifo* fifo );
 
@@ -49,19 +54,91 @@ void liberer_fifo( Fifo* fifo );
 int est_vide( Fifo* fifo );
 
 /*
- * Ajoute un élément au dessus de la pile.
+ * Renvoie le nombre d'éléments de la file.
+ */
+size_t taille_fifo( const Fifo* fifo );
+
+/*
+ * Ajoute un élément à la fin de la file.
  */
 void ajouter_fifo( Fifo* fifo, intptr_t element );
 
 /*
- * Retire un élément du dessus de la pile et le renvoie.
+ * Ajoute, dans l'ordre, les 'nb' éléments du tableau 'elements' à la fin de
+ * la file.
+ */
+void ajouter_elements_fifo( Fifo* fifo, const intptr_t* elements, size_t nb );
+
+/*
+ * Retire l'élément du début de la file et le renvoie.
+ * La file ne doit pas être vide.
  */
 intptr_t retirer_fifo( Fifo* fifo );
 
 /*
- * Renvoie l'élement qui se trouve au dessus de la pile. L'élément n'est pas
- * retiré de la pile.
+ * Retire au plus 'nb' éléments du début de la file et les range, dans 
+ * l'ordre, dans le tableau 'elements'. Renvoie le nombre d'éléments retirés.
+ */
+size_t retirer_elements_fifo( Fifo* fifo, intptr_t* elements, size_t nb );
+
+/*
+ * Renvoie l'élement qui se trouve au début de la file. L'élément n'est pas
+ * retiré de la file.
+ * La file ne doit pas être vide.
  */
 intptr_t obtenir_fifo( Fifo* fifo );
 
+
+/*
+ * Définit le type d'une deque de vol de tâches (Chase et Lev, 2005), pour 
+ * répartir un parcours entre plusieurs threads.
+ *
+ * Un seul thread, le propriétaire, ajoute et reprend des éléments par le 
+ * bas de la deque (ordre LIFO) ; les autres threads volent des éléments 
+ * par le haut (ordre FIFO). Aucune de ces opérations ne prend de verrou.
+ * Le tableau circulaire double quand il est plein ; les anciens tableaux, 
+ * que des voleurs peuvent encore être en train de lire, ne sont libérés 
+ * qu'avec la deque.
+ */
+typedef struct Deque Deque;
+
+/*
+ * Valeurs renvoyées par reprendre_deque() et voler_deque().
+ * DEQUE_ABANDON signifie qu'un autre thread a pris l'élément convoité : la
+ * deque n'est pas forcément vide et le voleur peut réessayer.
+ */
+typedef enum {
+	DEQUE_SUCCES,
+	DEQUE_VIDE,
+	DEQUE_ABANDON
+} Etat_deque;
+
+/*
+ * Créer une deque vide.
+ */
+Deque* creer_deque();
+
+/*
+ * Libère la deque. Aucun thread ne doit plus l'utiliser.
+ */
+void liberer_deque( Deque* deque );
+
+/*
+ * Ajoute un élément en bas de la deque. Réservé au propriétaire.
+ */
+void ajouter_deque( Deque* deque, intptr_t element );
+
+/*
+ * Retire l'élément du bas de la deque et le range dans '*element'. 
+ * Réservé au propriétaire. Renvoie DEQUE_SUCCES ou DEQUE_VIDE.
+ */
+Etat_deque reprendre_deque( Deque* deque, intptr_t* element );
+
+/*
+ * Retire l'élément du haut de la deque et le range dans '*element'.
+ * Peut être appelée par n'importe quel thread. Renvoie DEQUE_SUCCES, 
+ * DEQUE_VIDE ou DEQUE_ABANDON.
+ */
+Etat_deque voler_deque( Deque* deque, intptr_t* element );
+
 #endif
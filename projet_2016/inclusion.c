@@ -0,0 +1,681 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "inclusion.h"
+#include "automate_compile.h"
+#include "ensemble.h"
+#include "outils.h"
+
+#include <string.h>
+
+/*
+ * Les couples (p, S) découverts sont rangés dans des tableaux, dans l'ordre
+ * de leur découverte, qui est aussi celui du parcours en largeur : p est 
+ * l'indice d'un état compilé de A, S un tableau de bits sur les états 
+ * compilés de B. Chaque couple garde le couple et la lettre dont il vient,
+ * pour reconstruire le contre-exemple.
+ *
+ * Un couple est retiré de l'antichaîne de p (et n'est plus développé) 
+ * quand un couple plus petit arrive.
+ */
+typedef struct {
+	const Automate_compile * a;
+	const Automate_compile * b;
+	int nb;
+	int capacite;
+	int * etats;
+	int * parents;
+	char * lettres;
+	char * actifs;
+	uint64_t * ensembles;
+	int ** antichaines;
+	int * nb_antichaines;
+	int * capacites_antichaines;
+} Exploration_inclusion;
+
+static uint64_t * ensemble_couple( const Exploration_inclusion * e, int i ){
+	return e->ensembles + (size_t) i * e->b->nb_mots;
+}
+
+static int est_inclus_bits( 
+	const uint64_t * petit, const uint64_t * grand, int nb_mots 
+){
+	for( int i = 0; i < nb_mots; i++ ){
+		if( petit[i] & ~grand[i] ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static int est_disjoint_bits( 
+	const uint64_t * ens1, const uint64_t * ens2, int nb_mots 
+){
+	for( int i = 0; i < nb_mots; i++ ){
+		if( ens1[i] & ens2[i] ){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static int est_final_bits( const uint64_t * finaux, int etat ){
+	return ( finaux[ etat / 64 ] >> ( etat % 64 ) ) & 1;
+}
+
+static void initialiser_exploration( 
+	Exploration_inclusion * e, 
+	const Automate_compile * a, const Automate_compile * b 
+){
+	e->a = a;
+	e->b = b;
+	e->nb = 0;
+	e->capacite = 16;
+	e->etats = (int *) xmalloc( e->capacite * sizeof(int) );
+	e->parents = (int *) xmalloc( e->capacite * sizeof(int) );
+	e->lettres = (char *) xmalloc( e->capacite );
+	e->actifs = (char *) xmalloc( e->capacite );
+	e->ensembles = (uint64_t *) xmalloc( 
+		( (size_t) e->capacite * b->nb_mots + 1 ) * sizeof(uint64_t) 
+	);
+	e->antichaines = (int **) xmalloc( ( a->nb_etats + 1 ) * sizeof(int *) );
+	e->nb_antichaines = (int *) xmalloc( ( a->nb_etats + 1 ) * sizeof(int) );
+	e->capacites_antichaines = (int *) xmalloc( 
+		( a->nb_etats + 1 ) * sizeof(int) 
+	);
+	for( int p = 0; p < a->nb_etats; p++ ){
+		e->antichaines[p] = NULL;
+		e->nb_antichaines[p] = 0;
+		e->capacites_antichaines[p] = 0;
+	}
+}
+
+static void detruire_exploration( Exploration_inclusion * e ){
+	for( int p = 0; p < e->a->nb_etats; p++ ){
+		xfree( e->antichaines[p] );
+	}
+	xfree( e->antichaines );
+	xfree( e->nb_antichaines );
+	xfree( e->capacites_antichaines );
+	xfree( e->etats );
+	xfree( e->parents );
+	xfree( e->lettres );
+	xfree( e->actifs );
+	xfree( e->ensembles );
+}
+
+/*
+ * Ajoute le couple (p, S) s'il n'est pas subsumé par un couple de 
+ * l'antichaîne de p, et retire de l'antichaîne les couples qu'il subsume.
+ * Renvoie le numéro du couple ajouté, ou -1.
+ */
+static int ajouter_couple_antichaine(
+	Exploration_inclusion * e, int p, const uint64_t * ensemble, 
+	int parent, char lettre
+){
+	int nb_mots = e->b->nb_mots;
+	int * antichaine = e->antichaines[p];
+	for( int k = 0; k < e->nb_antichaines[p]; k++ ){
+		if( est_inclus_bits( ensemble_couple( e, antichaine[k] ), ensemble, nb_mots ) ){
+			return -1;
+		}
+	}
+	int nb = 0;
+	for( int k = 0; k < e->nb_antichaines[p]; k++ ){
+		if( est_inclus_bits( ensemble, ensemble_couple( e, antichaine[k] ), nb_mots ) ){
+			e->actifs[ antichaine[k] ] = 0;
+		}else{
+			antichaine[ nb++ ] = antichaine[k];
+		}
+	}
+	e->nb_antichaines[p] = nb;
+
+	if( e->nb == e->capacite ){
+		e->capacite *= 2;
+		e->etats = (int *) xrealloc( e->etats, e->capacite * sizeof(int) );
+		e->parents = (int *) xrealloc( e->parents, e->capacite * sizeof(int) );
+		e->lettres = (char *) xrealloc( e->lettres, e->capacite );
+		e->actifs = (char *) xrealloc( e->actifs, e->capacite );
+		e->ensembles = (uint64_t *) xrealloc( 
+			e->ensembles, 
+			( (size_t) e->capacite * nb_mots + 1 ) * sizeof(uint64_t) 
+		);
+	}
+	int i = e->nb++;
+	e->etats[i] = p;
+	e->parents[i] = parent;
+	e->lettres[i] = lettre;
+	e->actifs[i] = 1;
+	memcpy( ensemble_couple( e, i ), ensemble, nb_mots * sizeof(uint64_t) );
+
+	if( e->nb_antichaines[p] == e->capacites_antichaines[p] ){
+		e->capacites_antichaines[p] = 
+			e->capacites_antichaines[p] ? 2 * e->capacites_antichaines[p] : 4;
+		e->antichaines[p] = (int *) xrealloc( 
+			e->antichaines[p], e->capacites_antichaines[p] * sizeof(int) 
+		);
+	}
+	e->antichaines[p][ e->nb_antichaines[p]++ ] = i;
+	return i;
+}
+
+static int est_contre_exemple( const Exploration_inclusion * e, int i ){
+	return 
+		est_final_bits( e->a->finaux, e->etats[i] )
+		&& est_disjoint_bits( 
+			ensemble_couple( e, i ), e->b->finaux, e->b->nb_mots 
+		);
+}
+
+static char * mot_du_couple( const Exploration_inclusion * e, int i ){
+	int longueur = 0;
+	for( int j = i; e->parents[j] >= 0; j = e->parents[j] ){
+		longueur++;
+	}
+	char * res = (char *) xmalloc( longueur + 1 );
+	res[ longueur ] = '\0';
+	for( int j = i; e->parents[j] >= 0; j = e->parents[j] ){
+		res[ --longueur ] = e->lettres[j];
+	}
+	return res;
+}
+
+int est_inclus(
+	const Automate * automate_a, const Automate * automate_b, 
+	char ** contre_exemple
+){
+	Automate_compile * a = compiler_automate( automate_a );
+	Automate_compile * b = compiler_automate( automate_b );
+	Exploration_inclusion e;
+	initialiser_exploration( &e, a, b );
+	uint64_t * suivant = (uint64_t *) xmalloc( 
+		( b->nb_mots + 1 ) * sizeof(uint64_t) 
+	);
+	int trouve = -1;
+
+	for( int p = 0; p < a->nb_etats && trouve < 0; p++ ){
+		if( est_final_bits( a->initiaux, p ) ){
+			int i = ajouter_couple_antichaine( &e, p, b->initiaux, -1, '\0' );
+			if( i >= 0 && est_contre_exemple( &e, i ) ){
+				trouve = i;
+			}
+		}
+	}
+	for( int i = 0; i < e.nb && trouve < 0; i++ ){
+		if( ! e.actifs[i] ){
+			continue;
+		}
+		int p = e.etats[i];
+		for( int l = 0; l < a->nb_lettres && trouve < 0; l++ ){
+			char lettre = a->lettres[l];
+			const int * debut = a->debuts 
+				+ (size_t) p * a->nb_classes + a->classe[ (uint8_t) lettre ];
+			if( debut[0] == debut[1] ){
+				continue;
+			}
+			// 'e.ensembles' peut être déplacé par un ajout : on lit S avant.
+			delta_bits_compile( b, ensemble_couple( &e, i ), lettre, suivant );
+			for( int k = debut[0]; k < debut[1] && trouve < 0; k++ ){
+				int j = ajouter_couple_antichaine( 
+					&e, a->fins[k], suivant, i, lettre 
+				);
+				if( j >= 0 && est_contre_exemple( &e, j ) ){
+					trouve = j;
+				}
+			}
+			if( ! e.actifs[i] ){
+				break;
+			}
+		}
+	}
+
+	if( contre_exemple ){
+		*contre_exemple = trouve >= 0 ? mot_du_couple( &e, trouve ) : NULL;
+	}
+	xfree( suivant );
+	detruire_exploration( &e );
+	liberer_automate_compile( b );
+	liberer_automate_compile( a );
+	return trouve < 0;
+}
+
+int est_universel( const Automate * automate, char ** contre_exemple ){
+	Automate * tous_les_mots = creer_automate();
+	ajouter_etat_initial( tous_les_mots, 0 );
+	ajouter_etat_final( tous_les_mots, 0 );
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( get_alphabet( automate ) );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		ajouter_transition( tous_les_mots, 0, (char) get_element( it ), 0 );
+	}
+	int res = est_inclus( tous_les_mots, automate, contre_exemple );
+	liberer_automate( tous_les_mots );
+	return res;
+}
+
+/*
+ * Pour comparer deux automates, on range leurs états compilés dans un même
+ * espace : les états du premier gardent leur indice, ceux du second sont 
+ * décalés de nb_etats_1, et l'indice nb_etats_1 + nb_etats_2 désigne un 
+ * puits, pour les transitions qui manquent.
+ *
+ * Les lettres qui ont la même classe dans les deux automates se comportent
+ * de la même façon : on ne garde qu'une lettre par couple de classes.
+ */
+typedef struct {
+	const Automate_compile * a1;
+	const Automate_compile * a2;
+	int nb_etats;
+	int nb_lettres;
+	char lettres[256];
+	int classes_1[256];
+	int classes_2[256];
+} Comparaison;
+
+static void initialiser_comparaison( 
+	Comparaison * c, 
+	const Automate_compile * a1, const Automate_compile * a2
+){
+	c->a1 = a1;
+	c->a2 = a2;
+	c->nb_etats = a1->nb_etats + a2->nb_etats;
+	c->nb_lettres = 0;
+	for( int octet = 0; octet < 256; octet++ ){
+		int classe_1 = a1->classe[ octet ];
+		int classe_2 = a2->classe[ octet ];
+		if( classe_1 < 0 && classe_2 < 0 ){
+			continue;
+		}
+		int deja_vu = 0;
+		for( int l = 0; l < c->nb_lettres && ! deja_vu; l++ ){
+			deja_vu = 
+				c->classes_1[l] == classe_1 && c->classes_2[l] == classe_2;
+		}
+		if( ! deja_vu ){
+			c->lettres[ c->nb_lettres ] = (char) octet;
+			c->classes_1[ c->nb_lettres ] = classe_1;
+			c->classes_2[ c->nb_lettres ] = classe_2;
+			c->nb_lettres++;
+		}
+	}
+}
+
+static const int * successeurs_comparaison( 
+	const Comparaison * c, int etat, int l, int * nb, int * decalage
+){
+	const Automate_compile * a = c->a1;
+	int classe = c->classes_1[l];
+	*decalage = 0;
+	if( etat >= c->a1->nb_etats ){
+		a = c->a2;
+		classe = c->classes_2[l];
+		*decalage = c->a1->nb_etats;
+		etat -= c->a1->nb_etats;
+	}
+	if( classe < 0 ){
+		*nb = 0;
+		return NULL;
+	}
+	const int * debut = a->debuts + (size_t) etat * a->nb_classes + classe;
+	*nb = debut[1] - debut[0];
+	return a->fins + debut[0];
+}
+
+static int est_final_comparaison( const Comparaison * c, int etat ){
+	if( etat < c->a1->nb_etats ){
+		return est_final_bits( c->a1->finaux, etat );
+	}
+	etat -= c->a1->nb_etats;
+	return etat < c->a2->nb_etats && est_final_bits( c->a2->finaux, etat );
+}
+
+/*
+ * Les couples explorés, dans l'ordre du parcours en largeur, avec le couple
+ * et la lettre dont ils viennent.
+ */
+typedef struct {
+	int nb;
+	int capacite;
+	int * parents;
+	char * lettres;
+} Chemins;
+
+static void initialiser_chemins( Chemins * chemins ){
+	chemins->nb = 0;
+	chemins->capacite = 16;
+	chemins->parents = (int *) xmalloc( chemins->capacite * sizeof(int) );
+	chemins->lettres = (char *) xmalloc( chemins->capacite );
+}
+
+static void detruire_chemins( Chemins * chemins ){
+	xfree( chemins->parents );
+	xfree( chemins->lettres );
+}
+
+static int ajouter_chemin( Chemins * chemins, int parent, char lettre ){
+	if( chemins->nb == chemins->capacite ){
+		chemins->capacite *= 2;
+		chemins->parents = (int *) xrealloc( 
+			chemins->parents, chemins->capacite * sizeof(int) 
+		);
+		chemins->lettres = (char *) xrealloc( 
+			chemins->lettres, chemins->capacite 
+		);
+	}
+	chemins->parents[ chemins->nb ] = parent;
+	chemins->lettres[ chemins->nb ] = lettre;
+	return chemins->nb++;
+}
+
+static char * mot_du_chemin( const Chemins * chemins, int i ){
+	int longueur = 0;
+	for( int j = i; chemins->parents[j] >= 0; j = chemins->parents[j] ){
+		longueur++;
+	}
+	char * res = (char *) xmalloc( longueur + 1 );
+	res[ longueur ] = '\0';
+	for( int j = i; chemins->parents[j] >= 0; j = chemins->parents[j] ){
+		res[ --longueur ] = chemins->lettres[j];
+	}
+	return res;
+}
+
+static int trouver_representant( int * representants, int etat ){
+	while( representants[ etat ] != etat ){
+		representants[ etat ] = representants[ representants[ etat ] ];
+		etat = representants[ etat ];
+	}
+	return etat;
+}
+
+/*
+ * Réunit les classes des deux états ; renvoie 0 s'ils étaient déjà dans la
+ * même classe.
+ */
+static int reunir_etats( int * representants, int * rangs, int e1, int e2 ){
+	e1 = trouver_representant( representants, e1 );
+	e2 = trouver_representant( representants, e2 );
+	if( e1 == e2 ){
+		return 0;
+	}
+	if( rangs[ e1 ] < rangs[ e2 ] ){
+		int tmp = e1;
+		e1 = e2;
+		e2 = tmp;
+	}
+	representants[ e2 ] = e1;
+	if( rangs[ e1 ] == rangs[ e2 ] ){
+		rangs[ e1 ]++;
+	}
+	return 1;
+}
+
+static int premier_etat_initial( 
+	const Automate_compile * a, int decalage, int puits 
+){
+	for( int e = 0; e < a->nb_etats; e++ ){
+		if( est_final_bits( a->initiaux, e ) ){
+			return e + decalage;
+		}
+	}
+	return puits;
+}
+
+/*
+ * Hopcroft et Karp, pour deux automates déterministes. Renvoie le numéro 
+ * du chemin du premier couple distingué, ou -1.
+ */
+static int comparer_deterministes( const Comparaison * c, Chemins * chemins ){
+	int puits = c->nb_etats;
+	int * representants = (int *) xmalloc( ( puits + 1 ) * sizeof(int) );
+	int * rangs = (int *) xmalloc( ( puits + 1 ) * sizeof(int) );
+	for( int e = 0; e <= puits; e++ ){
+		representants[e] = e;
+		rangs[e] = 0;
+	}
+	int capacite = 16;
+	int * couples = (int *) xmalloc( 2 * capacite * sizeof(int) );
+
+	int initial_1 = premier_etat_initial( c->a1, 0, puits );
+	int initial_2 = premier_etat_initial( c->a2, c->a1->nb_etats, puits );
+	reunir_etats( representants, rangs, initial_1, initial_2 );
+	couples[0] = initial_1;
+	couples[1] = initial_2;
+	ajouter_chemin( chemins, -1, '\0' );
+
+	int trouve = -1;
+	for( int i = 0; i < chemins->nb && trouve < 0; i++ ){
+		int e1 = couples[ 2*i ];
+		int e2 = couples[ 2*i + 1 ];
+		if( est_final_comparaison( c, e1 ) != est_final_comparaison( c, e2 ) ){
+			trouve = i;
+			break;
+		}
+		for( int l = 0; l < c->nb_lettres; l++ ){
+			int nb, decalage;
+			const int * fins;
+			int s1 = puits, s2 = puits;
+			if( e1 != puits ){
+				fins = successeurs_comparaison( c, e1, l, &nb, &decalage );
+				if( nb ){ s1 = fins[0] + decalage; }
+			}
+			if( e2 != puits ){
+				fins = successeurs_comparaison( c, e2, l, &nb, &decalage );
+				if( nb ){ s2 = fins[0] + decalage; }
+			}
+			if( ! reunir_etats( representants, rangs, s1, s2 ) ){
+				continue;
+			}
+			int j = ajouter_chemin( chemins, i, c->lettres[l] );
+			if( j == capacite ){
+				capacite *= 2;
+				couples = (int *) xrealloc( 
+					couples, 2 * capacite * sizeof(int) 
+				);
+			}
+			couples[ 2*j ] = s1;
+			couples[ 2*j + 1 ] = s2;
+		}
+	}
+
+	xfree( couples );
+	xfree( rangs );
+	xfree( representants );
+	return trouve;
+}
+
+/*
+ * Ajoute à 'ensemble' les états de R tant qu'une règle s'applique : pour
+ * chaque couple (X, Y) de R, si X est inclus dans l'ensemble on y ajoute Y,
+ * et réciproquement. Deux ensembles sont égaux à congruence de R près si et
+ * seulement s'ils ont la même clôture.
+ */
+static void clore_ensemble( 
+	uint64_t * ensemble, const uint64_t * relation, int nb_couples, 
+	int nb_mots
+){
+	int modifie = 1;
+	while( modifie ){
+		modifie = 0;
+		for( int i = 0; i < nb_couples; i++ ){
+			const uint64_t * x = relation + (size_t) 2*i * nb_mots;
+			const uint64_t * y = x + nb_mots;
+			int x_inclus = est_inclus_bits( x, ensemble, nb_mots );
+			int y_inclus = est_inclus_bits( y, ensemble, nb_mots );
+			if( x_inclus == y_inclus ){
+				continue;
+			}
+			const uint64_t * ajout = x_inclus ? y : x;
+			for( int k = 0; k < nb_mots; k++ ){
+				ensemble[k] |= ajout[k];
+			}
+			modifie = 1;
+		}
+	}
+}
+
+static void successeurs_ensemble( 
+	const Comparaison * c, const uint64_t * ensemble, int l, 
+	uint64_t * res, int nb_mots
+){
+	memset( res, 0, nb_mots * sizeof(uint64_t) );
+	for( int k = 0; k < nb_mots; k++ ){
+		uint64_t mot = ensemble[k];
+		while( mot ){
+			int etat = k * 64 + __builtin_ctzll( mot );
+			mot &= mot - 1;
+			int nb, decalage;
+			const int * fins = successeurs_comparaison( 
+				c, etat, l, &nb, &decalage 
+			);
+			for( int i = 0; i < nb; i++ ){
+				int fin = fins[i] + decalage;
+				res[ fin / 64 ] |= UINT64_C(1) << ( fin % 64 );
+			}
+		}
+	}
+}
+
+static int ensemble_est_final( 
+	const uint64_t * ensemble, const uint64_t * finaux, int nb_mots 
+){
+	return ! est_disjoint_bits( ensemble, finaux, nb_mots );
+}
+
+/*
+ * Bisimulation à congruence près, pour deux automates quelconques. Les 
+ * couples explorés forment la relation R ; renvoie le numéro du chemin du 
+ * premier couple distingué, ou -1.
+ */
+static int comparer_ensembles( const Comparaison * c, Chemins * chemins ){
+	int nb_mots = ( c->nb_etats + 63 ) / 64 + 1;
+	int capacite = 16;
+	uint64_t * couples = (uint64_t *) xmalloc( 
+		(size_t) 2 * capacite * nb_mots * sizeof(uint64_t) 
+	);
+	uint64_t * relation = (uint64_t *) xmalloc( 
+		(size_t) 2 * capacite * nb_mots * sizeof(uint64_t) 
+	);
+	int nb_relation = 0;
+	uint64_t * clotures = (uint64_t *) xmalloc( 
+		2 * nb_mots * sizeof(uint64_t) 
+	);
+	uint64_t * finaux = (uint64_t *) xmalloc( nb_mots * sizeof(uint64_t) );
+	memset( finaux, 0, nb_mots * sizeof(uint64_t) );
+	for( int e = 0; e < c->nb_etats; e++ ){
+		if( est_final_comparaison( c, e ) ){
+			finaux[ e / 64 ] |= UINT64_C(1) << ( e % 64 );
+		}
+	}
+
+	memset( couples, 0, 2 * nb_mots * sizeof(uint64_t) );
+	for( int e = 0; e < c->a1->nb_etats; e++ ){
+		if( est_final_bits( c->a1->initiaux, e ) ){
+			couples[ e / 64 ] |= UINT64_C(1) << ( e % 64 );
+		}
+	}
+	for( int e = 0; e < c->a2->nb_etats; e++ ){
+		if( est_final_bits( c->a2->initiaux, e ) ){
+			int etat = e + c->a1->nb_etats;
+			couples[ nb_mots + etat / 64 ] |= UINT64_C(1) << ( etat % 64 );
+		}
+	}
+	ajouter_chemin( chemins, -1, '\0' );
+
+	int trouve = -1;
+	for( int i = 0; i < chemins->nb && trouve < 0; i++ ){
+		const uint64_t * x = couples + (size_t) 2*i * nb_mots;
+		const uint64_t * y = x + nb_mots;
+		memcpy( clotures, x, 2 * nb_mots * sizeof(uint64_t) );
+		clore_ensemble( clotures, relation, nb_relation, nb_mots );
+		clore_ensemble( clotures + nb_mots, relation, nb_relation, nb_mots );
+		if( memcmp( clotures, clotures + nb_mots, nb_mots * sizeof(uint64_t) ) == 0 ){
+			continue;
+		}
+		if( 
+			ensemble_est_final( x, finaux, nb_mots ) 
+			!= ensemble_est_final( y, finaux, nb_mots )
+		){
+			trouve = i;
+			break;
+		}
+		// Chaque couple exploré entre au plus une fois dans R : 'relation' 
+		// grandit avec 'couples'.
+		memcpy( 
+			relation + (size_t) 2 * nb_relation * nb_mots, x, 
+			2 * nb_mots * sizeof(uint64_t) 
+		);
+		nb_relation++;
+
+		for( int l = 0; l < c->nb_lettres; l++ ){
+			int j = ajouter_chemin( chemins, i, c->lettres[l] );
+			if( j == capacite ){
+				capacite *= 2;
+				couples = (uint64_t *) xrealloc( 
+					couples, (size_t) 2 * capacite * nb_mots * sizeof(uint64_t) 
+				);
+				relation = (uint64_t *) xrealloc( 
+					relation, (size_t) 2 * capacite * nb_mots * sizeof(uint64_t) 
+				);
+			}
+			x = couples + (size_t) 2*i * nb_mots;
+			y = x + nb_mots;
+			uint64_t * nouveau = couples + (size_t) 2*j * nb_mots;
+			successeurs_ensemble( c, x, l, nouveau, nb_mots );
+			successeurs_ensemble( c, y, l, nouveau + nb_mots, nb_mots );
+		}
+	}
+
+	xfree( finaux );
+	xfree( clotures );
+	xfree( relation );
+	xfree( couples );
+	return trouve;
+}
+
+int sont_equivalents(
+	const Automate * automate_1, const Automate * automate_2, 
+	char ** mot_distinguant
+){
+	Automate_compile * a1 = compiler_automate( automate_1 );
+	Automate_compile * a2 = compiler_automate( automate_2 );
+	Comparaison c;
+	initialiser_comparaison( &c, a1, a2 );
+	Chemins chemins;
+	initialiser_chemins( &chemins );
+
+	int trouve;
+	if( est_deterministe( automate_1 ) && est_deterministe( automate_2 ) ){
+		trouve = comparer_deterministes( &c, &chemins );
+	}else{
+		trouve = comparer_ensembles( &c, &chemins );
+	}
+
+	if( mot_distinguant ){
+		*mot_distinguant = trouve >= 0 ? mot_du_chemin( &chemins, trouve ) : NULL;
+	}
+	detruire_chemins( &chemins );
+	liberer_automate_compile( a2 );
+	liberer_automate_compile( a1 );
+	return trouve < 0;
+}
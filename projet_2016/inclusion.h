@@ -0,0 +1,100 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file inclusion.h */ 
+
+#ifndef __INCLUSION_H__
+#define __INCLUSION_H__
+
+#include "automate.h"
+
+/**
+ * @brief Renvoie 1 si le langage de A est inclus dans celui de B, 0 sinon.
+ *
+ * B n'est ni déterminisé ni complémenté. On explore les couples (p, S) où p
+ * est un état de A et S l'ensemble des états de B atteints en lisant le 
+ * même mot ; un couple est un contre-exemple si p est final et S ne 
+ * contient aucun état final. Un couple (p, S) est inutile dès qu'on a déjà
+ * un couple (p, S') avec S' inclus dans S : tout mot qui mène (p, S) à un 
+ * contre-exemple y mène aussi (p, S'). On ne garde donc, pour chaque p, 
+ * qu'une antichaîne d'ensembles minimaux.
+ *
+ * Si 'contre_exemple' n'est pas NULL, on y écrit, quand l'inclusion est 
+ * fausse, un mot de L(A) qui n'est pas dans L(B), alloué avec xmalloc() et 
+ * à libérer par l'utilisateur ; quand l'inclusion est vraie, on y écrit 
+ * NULL.
+ *
+ * @param automate_a L'automate A.
+ * @param automate_b L'automate B.
+ * @param contre_exemple NULL, ou l'adresse où écrire le contre-exemple.
+ * @return 1 ou 0
+ */
+int est_inclus(
+	const Automate * automate_a, const Automate * automate_b, 
+	char ** contre_exemple
+);
+
+/**
+ * @brief Renvoie 1 si l'automate reconnaît tous les mots sur son alphabet,
+ *        0 sinon.
+ *
+ * C'est l'inclusion (voir est_inclus()) dans L(A) de l'ensemble des mots 
+ * sur l'alphabet de A. Si 'contre_exemple' n'est pas NULL, on y écrit un mot
+ * qui n'est pas reconnu, ou NULL si l'automate est universel.
+ *
+ * @param automate Un automate.
+ * @param contre_exemple NULL, ou l'adresse où écrire le contre-exemple.
+ * @return 1 ou 0
+ */
+int est_universel( const Automate * automate, char ** contre_exemple );
+
+/**
+ * @brief Renvoie 1 si les deux automates reconnaissent le même langage, 
+ *        0 sinon.
+ *
+ * Aucun des deux automates n'est minimisé ni complémenté. Si les deux sont
+ * déterministes (voir est_deterministe()), on suit l'algorithme de Hopcroft
+ * et Karp : on parcourt les couples d'états atteints en lisant le même mot 
+ * en réunissant les deux états de chaque couple dans une structure 
+ * union-find, et on n'explore pas un couple dont les deux états sont déjà 
+ * réunis. Le temps est presque linéaire en le nombre de transitions.
+ *
+ * Sinon, on parcourt les couples d'ensembles d'états obtenus en 
+ * déterminisant les deux automates à la volée, et on n'explore pas un 
+ * couple qui se déduit des couples déjà explorés par réunions et 
+ * transitivité (bisimulation à congruence près).
+ *
+ * Les couples sont parcourus en largeur : si 'mot_distinguant' n'est pas 
+ * NULL, on y écrit, quand les langages diffèrent, un plus court mot 
+ * reconnu par un seul des deux automates, alloué avec xmalloc() et à 
+ * libérer par l'utilisateur ; quand les langages sont égaux, on y écrit 
+ * NULL.
+ *
+ * @param automate_1 Un automate.
+ * @param automate_2 Un automate.
+ * @param mot_distinguant NULL, ou l'adresse où écrire le mot distinguant.
+ * @return 1 ou 0
+ */
+int sont_equivalents(
+	const Automate * automate_1, const Automate * automate_2, 
+	char ** mot_distinguant
+);
+
+#endif
@@ -0,0 +1,142 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "pool.h"
+#include "outils.h"
+
+#include <assert.h>
+
+#define POOL_TAILLE_MIN_TRONCON 128
+#define POOL_TAILLE_MAX_TRONCON 65536
+
+struct Pool_bloc_libre {
+	Pool_bloc_libre * suivant;
+};
+
+/*
+ * En-tête d'un tronçon. L'union garantit que les blocs qui suivent l'en-tête
+ * sont alignés pour n'importe quel type.
+ */
+struct Pool_troncon {
+	union {
+		Pool_troncon * suivant;
+		char alignement[POOL_GRANULARITE];
+	};
+};
+
+static size_t arrondir( size_t taille ){
+	if( taille == 0 ) taille = 1;
+	return ( taille + POOL_GRANULARITE - 1 ) & ~( (size_t) POOL_GRANULARITE - 1 );
+}
+
+static void * avl_malloc_pool( struct libavl_allocator * allocateur, size_t taille ){
+	return allouer_pool( (Pool*) allocateur, taille );
+}
+
+static void avl_free_pool( struct libavl_allocator * allocateur, void * bloc ){
+	rendre_pool( (Pool*) allocateur, bloc, sizeof( struct avl_node ) );
+}
+
+void initialiser_pool( Pool * pool ){
+	int i;
+	pool->allocateur.libavl_malloc = avl_malloc_pool;
+	pool->allocateur.libavl_free = avl_free_pool;
+	for( i=0; i<POOL_NB_CLASSES; i++ ){
+		pool->libres[i] = NULL;
+	}
+	pool->troncons = NULL;
+	pool->courant = NULL;
+	pool->reste = 0;
+	pool->taille_prochain_troncon = POOL_TAILLE_MIN_TRONCON;
+}
+
+Pool * creer_pool(){
+	Pool * pool = xmalloc( sizeof(Pool) );
+	initialiser_pool( pool );
+	return pool;
+}
+
+void vider_pool( Pool * pool ){
+	Pool_troncon * troncon = pool->troncons;
+	while( troncon ){
+		Pool_troncon * suivant = troncon->suivant;
+		xfree( troncon );
+		troncon = suivant;
+	}
+	initialiser_pool( pool );
+}
+
+void liberer_pool( Pool * pool ){
+	vider_pool( pool );
+	xfree( pool );
+}
+
+static Pool_troncon * ajouter_troncon( Pool * pool, size_t taille ){
+	Pool_troncon * troncon = xmalloc( sizeof(Pool_troncon) + taille );
+	troncon->suivant = pool->troncons;
+	pool->troncons = troncon;
+	return troncon;
+}
+
+void * allouer_pool( Pool * pool, size_t taille ){
+	taille = arrondir( taille );
+	size_t classe = ( taille - 1 ) / POOL_GRANULARITE;
+	if( classe < POOL_NB_CLASSES && pool->libres[classe] ){
+		Pool_bloc_libre * bloc = pool->libres[classe];
+		pool->libres[classe] = bloc->suivant;
+		return bloc;
+	}
+	if( taille > pool->reste ){
+		if( taille > POOL_TAILLE_MAX_TRONCON / 2 ){
+			// Un gros bloc a son propre tronçon : on garde le tronçon 
+			// courant pour les petits blocs.
+			return ajouter_troncon( pool, taille ) + 1;
+		}
+		while( pool->taille_prochain_troncon < taille ){
+			pool->taille_prochain_troncon *= 2;
+		}
+		pool->courant = (char*) (
+			ajouter_troncon( pool, pool->taille_prochain_troncon ) + 1
+		);
+		pool->reste = pool->taille_prochain_troncon;
+		if( pool->taille_prochain_troncon < POOL_TAILLE_MAX_TRONCON ){
+			pool->taille_prochain_troncon *= 2;
+		}
+	}
+	void * bloc = pool->courant;
+	pool->courant += taille;
+	pool->reste -= taille;
+	return bloc;
+}
+
+void rendre_pool( Pool * pool, void * bloc, size_t taille ){
+	assert( bloc );
+	size_t classe = ( arrondir( taille ) - 1 ) / POOL_GRANULARITE;
+	if( classe < POOL_NB_CLASSES ){
+		Pool_bloc_libre * libre = (Pool_bloc_libre*) bloc;
+		libre->suivant = pool->libres[classe];
+		pool->libres[classe] = libre;
+	}
+}
+
+struct libavl_allocator * allocateur_avl_pool( Pool * pool ){
+	return &pool->allocateur;
+}
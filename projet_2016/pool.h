@@ -0,0 +1,111 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef __POOL_H__
+#define __POOL_H__
+
+#include <stddef.h>
+
+#include "avl.h"
+
+/*
+ * Granularité et nombre des classes de taille d'un pool.
+ * Un bloc de n octets est rangé dans la classe (n-1)/POOL_GRANULARITE.
+ * Les blocs plus grands que POOL_GRANULARITE * POOL_NB_CLASSES ne sont pas 
+ * recyclés : leur mémoire n'est rendue qu'à la destruction du pool.
+ */
+#define POOL_GRANULARITE 16
+#define POOL_NB_CLASSES 16
+
+typedef struct Pool_bloc_libre Pool_bloc_libre;
+typedef struct Pool_troncon Pool_troncon;
+
+/*
+ * Définit le type d'un pool mémoire.
+ *
+ * Un pool découpe de gros tronçons de mémoire en petits blocs. Les blocs 
+ * rendus au pool sont rangés dans une liste de blocs libres par classe de 
+ * taille et sont réutilisés par les allocations suivantes. Tous les blocs
+ * sont libérés d'un coup à la destruction (ou à la remise à zéro) du pool :
+ * on ne fait alors qu'un free() par tronçon.
+ *
+ * La taille des tronçons double à chaque nouveau tronçon, en partant d'une
+ * petite taille : un pool qui ne contient que quelques blocs reste petit.
+ *
+ * Le premier champ du pool est un allocateur libavl : l'adresse du pool
+ * peut être passée à avl_create() (voir allocateur_avl_pool()).
+ *
+ * La structure est publique pour pouvoir être incluse dans une autre 
+ * structure, mais ses champs ne doivent pas être manipulés directement.
+ */
+typedef struct Pool {
+	struct libavl_allocator allocateur;
+	Pool_bloc_libre * libres[POOL_NB_CLASSES];
+	Pool_troncon * troncons;
+	char * courant;
+	size_t reste;
+	size_t taille_prochain_troncon;
+} Pool;
+
+/*
+ * Initialise un pool vide, sans allouer de mémoire.
+ */
+void initialiser_pool( Pool * pool );
+
+/*
+ * Crée un nouveau pool vide.
+ */
+Pool * creer_pool();
+
+/*
+ * Rend au système toute la mémoire du pool. Les blocs alloués dans le pool
+ * deviennent invalides. Le pool peut être réutilisé ensuite.
+ */
+void vider_pool( Pool * pool );
+
+/*
+ * Libère un pool créé par creer_pool() ainsi que tous ses blocs.
+ */
+void liberer_pool( Pool * pool );
+
+/*
+ * Alloue un bloc d'au moins 'taille' octets dans le pool.
+ * Le bloc est aligné pour n'importe quel type.
+ */
+void * allouer_pool( Pool * pool, size_t taille );
+
+/*
+ * Rend au pool un bloc alloué par allouer_pool() avec la même taille.
+ * Le bloc sera réutilisé par une prochaine allocation de la même classe.
+ */
+void rendre_pool( Pool * pool, void * bloc, size_t taille );
+
+/*
+ * Renvoie l'allocateur libavl associé au pool.
+ *
+ * libavl ne donne pas la taille des blocs qu'elle libère ; les seuls blocs
+ * qu'elle alloue sont ses noeuds et la structure de l'arbre, qui est plus 
+ * grande qu'un noeud. Un bloc libéré par libavl est donc rangé dans la 
+ * classe des noeuds.
+ */
+struct libavl_allocator * allocateur_avl_pool( Pool * pool );
+
+#endif
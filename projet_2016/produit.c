@@ -0,0 +1,354 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "produit.h"
+#include "couples.h"
+#include "ensemble.h"
+#include "outils.h"
+
+static char * copier_lettres( 
+	const Ensemble * lettres, const Ensemble * autres, int communes, int * nb 
+){
+	char * res = (char *) xmalloc( taille_ensemble( lettres ) + 1 );
+	*nb = 0;
+	Ensemble_iterateur it;
+	for(
+		it = premier_iterateur_ensemble( lettres );
+		! iterateur_ensemble_est_vide( it );
+		it = iterateur_suivant_ensemble( it )
+	){
+		char lettre = (char) get_element( it );
+		if( est_dans_l_ensemble( autres, lettre ) == communes ){
+			res[ (*nb)++ ] = lettre;
+		}
+	}
+	return res;
+}
+
+Produit * creer_produit(
+	const Automate * automate_1, const Automate * automate_2, 
+	Type_produit type
+){
+	Produit * res = (Produit *) xmalloc( sizeof(Produit) );
+	res->automate_1 = automate_1;
+	res->automate_2 = automate_2;
+	res->type = type;
+	const Ensemble * alphabet_1 = get_alphabet( automate_1 );
+	const Ensemble * alphabet_2 = get_alphabet( automate_2 );
+	res->communes = copier_lettres( 
+		alphabet_1, alphabet_2, 1, &res->nb_communes 
+	);
+	res->propres_1 = copier_lettres( 
+		alphabet_1, alphabet_2, 0, &res->nb_propres_1 
+	);
+	res->propres_2 = copier_lettres( 
+		alphabet_2, alphabet_1, 0, &res->nb_propres_2 
+	);
+	if( type == PRODUIT_INTERSECTION ){
+		res->nb_propres_1 = 0;
+		res->nb_propres_2 = 0;
+	}
+	return res;
+}
+
+void liberer_produit( Produit * produit ){
+	if( produit ){
+		xfree( produit->communes );
+		xfree( produit->propres_1 );
+		xfree( produit->propres_2 );
+		xfree( produit );
+	}
+}
+
+/*
+ * Les trois façons de lire une lettre depuis le couple (etat_1, etat_2) :
+ * avec le premier automate seul, avec le second seul, ou avec les deux.
+ */
+static void avancer_1(
+	const Produit * produit, int etat_1, int etat_2, char lettre,
+	void (* action )( char lettre, int fin_1, int fin_2, void * data ),
+	void * data
+){
+	Ensemble_iterateur it_1;
+	for(
+		it_1 = premier_iterateur_ensemble( 
+			voisins( produit->automate_1, etat_1, lettre ) 
+		);
+		! iterateur_ensemble_est_vide( it_1 );
+		it_1 = iterateur_suivant_ensemble( it_1 )
+	){
+		action( lettre, get_element( it_1 ), etat_2, data );
+	}
+}
+
+static void avancer_2(
+	const Produit * produit, int etat_1, int etat_2, char lettre,
+	void (* action )( char lettre, int fin_1, int fin_2, void * data ),
+	void * data
+){
+	Ensemble_iterateur it_2;
+	for(
+		it_2 = premier_iterateur_ensemble( 
+			voisins( produit->automate_2, etat_2, lettre ) 
+		);
+		! iterateur_ensemble_est_vide( it_2 );
+		it_2 = iterateur_suivant_ensemble( it_2 )
+	){
+		action( lettre, etat_1, get_element( it_2 ), data );
+	}
+}
+
+static void avancer_ensemble(
+	const Produit * produit, int etat_1, int etat_2, char lettre,
+	void (* action )( char lettre, int fin_1, int fin_2, void * data ),
+	void * data
+){
+	const Ensemble * fins_2 = voisins( produit->automate_2, etat_2, lettre );
+	if( taille_ensemble( fins_2 ) == 0 ){
+		return;
+	}
+	Ensemble_iterateur it_1, it_2;
+	for(
+		it_1 = premier_iterateur_ensemble( 
+			voisins( produit->automate_1, etat_1, lettre ) 
+		);
+		! iterateur_ensemble_est_vide( it_1 );
+		it_1 = iterateur_suivant_ensemble( it_1 )
+	){
+		for(
+			it_2 = premier_iterateur_ensemble( fins_2 );
+			! iterateur_ensemble_est_vide( it_2 );
+			it_2 = iterateur_suivant_ensemble( it_2 )
+		){
+			action( lettre, get_element( it_1 ), get_element( it_2 ), data );
+		}
+	}
+}
+
+void pour_tout_successeur_produit(
+	const Produit * produit, int etat_1, int etat_2,
+	void (* action )( char lettre, int fin_1, int fin_2, void * data ),
+	void * data
+){
+	for( int l = 0; l < produit->nb_communes; l++ ){
+		char lettre = produit->communes[l];
+		if( produit->type == PRODUIT_MELANGE ){
+			avancer_1( produit, etat_1, etat_2, lettre, action, data );
+			avancer_2( produit, etat_1, etat_2, lettre, action, data );
+		}else{
+			avancer_ensemble( produit, etat_1, etat_2, lettre, action, data );
+		}
+	}
+	for( int l = 0; l < produit->nb_propres_1; l++ ){
+		avancer_1( produit, etat_1, etat_2, produit->propres_1[l], action, data );
+	}
+	for( int l = 0; l < produit->nb_propres_2; l++ ){
+		avancer_2( produit, etat_1, etat_2, produit->propres_2[l], action, data );
+	}
+}
+
+static void ajouter_couples_initiaux( const Produit * produit, Couples * couples ){
+	Ensemble_iterateur it_1, it_2;
+	for(
+		it_1 = premier_iterateur_ensemble( get_initiaux( produit->automate_1 ) );
+		! iterateur_ensemble_est_vide( it_1 );
+		it_1 = iterateur_suivant_ensemble( it_1 )
+	){
+		for(
+			it_2 = premier_iterateur_ensemble( 
+				get_initiaux( produit->automate_2 ) 
+			);
+			! iterateur_ensemble_est_vide( it_2 );
+			it_2 = iterateur_suivant_ensemble( it_2 )
+		){
+			ajouter_couple( couples, get_element( it_1 ), get_element( it_2 ) );
+		}
+	}
+}
+
+static int est_final_produit( const Produit * produit, int etat_1, int etat_2 ){
+	return 
+		est_un_etat_final_de_l_automate( produit->automate_1, etat_1 )
+		&& est_un_etat_final_de_l_automate( produit->automate_2, etat_2 );
+}
+
+static void action_ajouter_couple( 
+	char lettre, int fin_1, int fin_2, void * data 
+){
+	ajouter_couple( (Couples *) data, fin_1, fin_2 );
+}
+
+typedef struct Parcours_produit {
+	Couples vus;
+	Automate * automate;
+	int origine;
+} Parcours_produit;
+
+static void action_decouvrir_couple( 
+	char lettre, int fin_1, int fin_2, void * data 
+){
+	Parcours_produit * parcours = (Parcours_produit *) data;
+	int fin = (int) numeroter_couple( &parcours->vus, fin_1, fin_2 );
+	if( parcours->automate ){
+		ajouter_transition( parcours->automate, parcours->origine, lettre, fin );
+	}
+}
+
+/*
+ * Parcours en largeur des couples accessibles : l'ensemble des couples vus 
+ * sert de file, et la place d'un couple dans la file est son numéro. 
+ *
+ * Si 'automate' n'est pas NULL, le parcours y construit le produit, sur 
+ * les numéros des couples, et ne s'arrête pas. Sinon, il s'arrête au 
+ * premier couple pour lequel 'but' renvoie vrai, et renvoie alors 1 ; il 
+ * renvoie 0 s'il n'y en a aucun.
+ */
+static int parcourir_produit(
+	const Produit * produit, Automate * automate,
+	int (* but )( const Produit * produit, int etat_1, int etat_2, void * data ),
+	void * data
+){
+	Parcours_produit parcours;
+	initialiser_couples( &parcours.vus );
+	parcours.automate = automate;
+	ajouter_couples_initiaux( produit, &parcours.vus );
+	for( size_t k = 0; automate && k < nb_couples( &parcours.vus ); k++ ){
+		ajouter_etat_initial( automate, (int) k );
+	}
+	int res = 0;
+	for( size_t k = 0; k < nb_couples( &parcours.vus ) && ! res; k++ ){
+		int etat_1, etat_2;
+		get_couple( &parcours.vus, k, &etat_1, &etat_2 );
+		if( automate ){
+			if( est_final_produit( produit, etat_1, etat_2 ) ){
+				ajouter_etat_final( automate, (int) k );
+			}
+		}else if( but( produit, etat_1, etat_2, data ) ){
+			res = 1;
+			continue;
+		}
+		parcours.origine = (int) k;
+		pour_tout_successeur_produit( 
+			produit, etat_1, etat_2, action_decouvrir_couple, &parcours 
+		);
+	}
+	detruire_couples( &parcours.vus );
+	return res;
+}
+
+Automate * construire_produit( const Produit * produit ){
+	Automate * res = creer_automate();
+	for( int l = 0; l < produit->nb_communes; l++ ){
+		ajouter_lettre( res, produit->communes[l] );
+	}
+	for( int l = 0; l < produit->nb_propres_1; l++ ){
+		ajouter_lettre( res, produit->propres_1[l] );
+	}
+	for( int l = 0; l < produit->nb_propres_2; l++ ){
+		ajouter_lettre( res, produit->propres_2[l] );
+	}
+	parcourir_produit( produit, res, NULL, NULL );
+	return res;
+}
+
+static int but_final( 
+	const Produit * produit, int etat_1, int etat_2, void * data 
+){
+	return est_final_produit( produit, etat_1, etat_2 );
+}
+
+int produit_est_vide( const Produit * produit ){
+	return ! parcourir_produit( produit, NULL, but_final, NULL );
+}
+
+static int but_couple( 
+	const Produit * produit, int etat_1, int etat_2, void * data 
+){
+	const int * couple = (const int *) data;
+	return etat_1 == couple[0] && etat_2 == couple[1];
+}
+
+int couple_est_accessible_produit( 
+	const Produit * produit, int etat_1, int etat_2 
+){
+	int couple[2] = { etat_1, etat_2 };
+	return parcourir_produit( produit, NULL, but_couple, couple );
+}
+
+/*
+ * Les couples atteints après chaque préfixe du mot forment la frontière. 
+ * Selon la lettre, les deux automates, un seul ou aucun avancent ; dans le
+ * produit synchrone, une lettre qu'aucun ne lit laisse la frontière telle
+ * quelle. Dans le mélange, une lettre commune fait avancer l'un ou l'autre.
+ */
+int le_mot_est_reconnu_produit( const Produit * produit, const char * mot ){
+	Couples frontieres[2];
+	initialiser_couples( &frontieres[0] );
+	initialiser_couples( &frontieres[1] );
+	Couples * courante = &frontieres[0];
+	Couples * suivante = &frontieres[1];
+	ajouter_couples_initiaux( produit, courante );
+
+	for( const char * p = mot; *p && nb_couples( courante ); p++ ){
+		int lit_1 = est_une_lettre_de_l_automate( produit->automate_1, *p );
+		int lit_2 = est_une_lettre_de_l_automate( produit->automate_2, *p );
+		if( produit->type == PRODUIT_INTERSECTION && ! ( lit_1 && lit_2 ) ){
+			lit_1 = lit_2 = 0;
+		}else if( produit->type == PRODUIT_SYNCHRONE && ! lit_1 && ! lit_2 ){
+			// Les deux projections effacent la lettre.
+			continue;
+		}
+		int ensemble = lit_1 && lit_2 && produit->type != PRODUIT_MELANGE;
+		vider_couples( suivante );
+		for( size_t k = 0; k < nb_couples( courante ) && ( lit_1 || lit_2 ); k++ ){
+			int etat_1, etat_2;
+			get_couple( courante, k, &etat_1, &etat_2 );
+			if( ensemble ){
+				avancer_ensemble( 
+					produit, etat_1, etat_2, *p, action_ajouter_couple, suivante 
+				);
+				continue;
+			}
+			if( lit_1 ){
+				avancer_1( 
+					produit, etat_1, etat_2, *p, action_ajouter_couple, suivante 
+				);
+			}
+			if( lit_2 ){
+				avancer_2( 
+					produit, etat_1, etat_2, *p, action_ajouter_couple, suivante 
+				);
+			}
+		}
+		Couples * tmp = courante;
+		courante = suivante;
+		suivante = tmp;
+	}
+
+	int res = 0;
+	for( size_t k = 0; k < nb_couples( courante ) && ! res; k++ ){
+		int etat_1, etat_2;
+		get_couple( courante, k, &etat_1, &etat_2 );
+		res = est_final_produit( produit, etat_1, etat_2 );
+	}
+	detruire_couples( &frontieres[0] );
+	detruire_couples( &frontieres[1] );
+	return res;
+}
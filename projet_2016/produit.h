@@ -0,0 +1,172 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file produit.h */ 
+
+#ifndef __PRODUIT_H__
+#define __PRODUIT_H__
+
+#include "automate.h"
+
+/**
+ * @brief Les produits de deux automates que l'on peut parcourir.
+ */
+typedef enum {
+	/**
+	 * Les deux automates lisent chaque lettre ensemble : seules les lettres
+	 * communes aux deux alphabets sont lues. Le produit reconnaît 
+	 * l'intersection des deux langages.
+	 */
+	PRODUIT_INTERSECTION,
+	/**
+	 * Les lettres communes aux deux alphabets sont lues ensemble, une 
+	 * lettre propre à un alphabet n'est lue que par son automate, l'autre 
+	 * ne bougeant pas. Un mot est reconnu si sa projection sur chacun des 
+	 * deux alphabets est reconnue par l'automate correspondant : une 
+	 * lettre qui n'est dans aucun des deux alphabets est effacée par les 
+	 * deux projections, et ne change rien.
+	 */
+	PRODUIT_SYNCHRONE,
+	/**
+	 * Chaque lettre est lue par un seul des deux automates, l'autre ne 
+	 * bougeant pas : une lettre commune peut être lue par l'un ou par 
+	 * l'autre. Le produit reconnaît le mélange des deux langages (voir 
+	 * creer_automate_du_melange()).
+	 */
+	PRODUIT_MELANGE
+} Type_produit;
+
+/**
+ * @brief Le type d'une vue sur le produit de deux automates.
+ *
+ * Le produit n'est construit que par construire_produit() : ses états sont
+ * les couples (e1, e2) d'un état du premier automate et d'un état du 
+ * second, et les successeurs d'un couple sont calculés à la demande à 
+ * partir des transitions des deux automates (voir voisins()). Les 
+ * parcours ne visitent donc que les couples accessibles, et s'arrêtent dès
+ * que la réponse est connue.
+ *
+ * Un couple est initial (resp. final) si ses deux états le sont.
+ *
+ * La vue garde des pointeurs vers les deux automates, qui ne doivent être 
+ * ni modifiés ni libérés tant qu'elle est utilisée.
+ */
+typedef struct Produit {
+	const Automate * automate_1;
+	const Automate * automate_2;
+	Type_produit type;
+	char * communes;
+	int nb_communes;
+	char * propres_1;
+	int nb_propres_1;
+	char * propres_2;
+	int nb_propres_2;
+} Produit;
+
+/**
+ * @brief Crée une vue sur le produit de deux automates.
+ *
+ * @param automate_1 Le premier automate.
+ * @param automate_2 Le deuxième automate.
+ * @param type Le produit à parcourir.
+ * @return La vue, à libérer avec liberer_produit().
+ */
+Produit * creer_produit(
+	const Automate * automate_1, const Automate * automate_2, 
+	Type_produit type
+);
+
+/**
+ * @brief Libère une vue. Les automates ne sont pas libérés.
+ *
+ * @param produit Une vue.
+ */
+void liberer_produit( Produit * produit );
+
+/**
+ * @brief Appelle 'action' pour chaque transition du produit partant du 
+ *        couple (etat_1, etat_2).
+ *
+ * La fonction 'action' reçoit la lettre et le couple d'arrivée de la 
+ * transition. Une même transition peut être donnée plusieurs fois.
+ *
+ * @param produit Une vue.
+ * @param etat_1 Un état du premier automate.
+ * @param etat_2 Un état du second automate.
+ * @param action La fonction à exécuter.
+ * @param data La donnée supplémentaire passée en paramètre à 'action'.
+ */
+void pour_tout_successeur_produit(
+	const Produit * produit, int etat_1, int etat_2,
+	void (* action )( char lettre, int fin_1, int fin_2, void * data ),
+	void * data
+);
+
+/**
+ * @brief Construit la partie accessible du produit.
+ *
+ * Les couples sont numérotés 0, 1, ... dans l'ordre où le parcours en 
+ * largeur les découvre, à partir des couples initiaux. L'alphabet de 
+ * l'automate est celui des lettres que le produit peut lire. Pour 
+ * PRODUIT_SYNCHRONE, une lettre qui n'est dans aucun des deux alphabets 
+ * n'est pas lue par l'automate construit : il faut l'effacer du mot.
+ *
+ * @param produit Une vue.
+ * @return L'automate, à libérer par l'utilisateur.
+ */
+Automate * construire_produit( const Produit * produit );
+
+/**
+ * @brief Renvoie 1 si le mot est reconnu par le produit, 0 sinon.
+ *
+ * @param produit Une vue.
+ * @param mot Le mot à reconnaître.
+ * @return 1 ou 0
+ */
+int le_mot_est_reconnu_produit( const Produit * produit, const char * mot );
+
+/**
+ * @brief Renvoie 1 si le produit ne reconnaît aucun mot, 0 sinon.
+ *
+ * Pour PRODUIT_INTERSECTION, c'est vrai si et seulement si les langages des
+ * deux automates sont disjoints. Le parcours s'arrête au premier couple 
+ * final atteint.
+ *
+ * @param produit Une vue.
+ * @return 1 ou 0
+ */
+int produit_est_vide( const Produit * produit );
+
+/**
+ * @brief Renvoie 1 si le couple (etat_1, etat_2) est accessible depuis les
+ *        couples initiaux du produit, 0 sinon.
+ *
+ * Le parcours s'arrête dès que le couple est atteint.
+ *
+ * @param produit Une vue.
+ * @param etat_1 Un état du premier automate.
+ * @param etat_2 Un état du second automate.
+ * @return 1 ou 0
+ */
+int couple_est_accessible_produit( 
+	const Produit * produit, int etat_1, int etat_2 
+);
+
+#endif
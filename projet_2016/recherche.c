@@ -0,0 +1,317 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "recherche.h"
+#include "outils.h"
+
+#define AUCUNE ( (size_t) -1 )
+
+Recherche * creer_recherche( const Automate * automate ){
+	Recherche * res = (Recherche *) xmalloc( sizeof(Recherche) );
+	Automate * inverse = miroir( automate );
+	res->automate = compiler_automate( automate );
+	res->miroir = compiler_automate( inverse );
+	liberer_automate( inverse );
+	return res;
+}
+
+void liberer_recherche( Recherche * recherche ){
+	if( recherche ){
+		liberer_automate_compile( recherche->automate );
+		liberer_automate_compile( recherche->miroir );
+		xfree( recherche );
+	}
+}
+
+/*
+ * Les états courants d'une lecture, chacun avec une position : la liste 
+ * 'actifs' donne les états courants, et positions[e] vaut AUCUNE pour un 
+ * état qui n'est pas courant. Quand plusieurs chemins mènent au même état,
+ * on ne garde que la plus petite position (lecture du texte à l'endroit) 
+ * ou la plus grande (lecture à l'envers) : tout ce qui est lu ensuite ne 
+ * dépend que de l'état.
+ */
+typedef struct {
+	size_t * positions;
+	int * actifs;
+	int nb_actifs;
+} Positions_etats;
+
+/*
+ * Une lecture du texte où l'on entre dans l'automate avant chaque lettre. 
+ * Plutôt que d'ajouter tous les états initiaux à chaque position, on 
+ * ajoute, après chaque lettre, ses successeurs depuis les états initiaux : 
+ * pour la classe c, ce sont les entrees[k] pour debuts_entrees[c] <= k < 
+ * debuts_entrees[c+1]. Une lettre coûte ainsi O(|Q| + |delta|) au pire, 
+ * et en pratique le nombre de transitions suivies depuis les états qui 
+ * restent courants, quelle que soit la longueur des occurrences.
+ */
+typedef struct {
+	const Automate_compile * automate;
+	int a_l_envers;
+	int mot_vide;
+	int * debuts_entrees;
+	int * entrees;
+	Positions_etats * courant;
+	Positions_etats * suivant;
+	Positions_etats tampons[2];
+} Lecture_positions;
+
+static int est_dans_bits( const uint64_t * bits, int e ){
+	return ( bits[ e / 64 ] >> ( e % 64 ) ) & 1;
+}
+
+static void initialiser_positions( 
+	Positions_etats * p, const Automate_compile * automate 
+){
+	p->positions = (size_t *) xmalloc( 
+		( automate->nb_etats + 1 ) * sizeof(size_t) 
+	);
+	p->actifs = (int *) xmalloc( ( automate->nb_etats + 1 ) * sizeof(int) );
+	p->nb_actifs = 0;
+	for( int e = 0; e < automate->nb_etats; e++ ){
+		p->positions[e] = AUCUNE;
+	}
+}
+
+static void detruire_positions( Positions_etats * p ){
+	xfree( p->positions );
+	xfree( p->actifs );
+}
+
+static int meilleure_position( 
+	const Lecture_positions * l, size_t position, size_t ancienne 
+){
+	return 
+		ancienne == AUCUNE 
+		|| ( l->a_l_envers ? position > ancienne : position < ancienne );
+}
+
+static void garder_position( 
+	const Lecture_positions * l, Positions_etats * p, int e, size_t position
+){
+	if( p->positions[e] == AUCUNE ){
+		p->actifs[ p->nb_actifs++ ] = e;
+		p->positions[e] = position;
+	}else if( meilleure_position( l, position, p->positions[e] ) ){
+		p->positions[e] = position;
+	}
+}
+
+static void initialiser_lecture( 
+	Lecture_positions * l, const Automate_compile * automate, int a_l_envers
+){
+	l->automate = automate;
+	l->a_l_envers = a_l_envers;
+	l->mot_vide = 0;
+	for( int i = 0; i < automate->nb_mots; i++ ){
+		if( automate->initiaux[i] & automate->finaux[i] ){
+			l->mot_vide = 1;
+		}
+	}
+	initialiser_positions( &l->tampons[0], automate );
+	initialiser_positions( &l->tampons[1], automate );
+	l->courant = &l->tampons[0];
+	l->suivant = &l->tampons[1];
+
+	// Les successeurs des états initiaux, sans doublon, classe par classe.
+	Positions_etats * vus = l->suivant;
+	l->debuts_entrees = (int *) xmalloc( 
+		( automate->nb_classes + 1 ) * sizeof(int) 
+	);
+	int capacite = 16;
+	int nb = 0;
+	l->entrees = (int *) xmalloc( capacite * sizeof(int) );
+	for( int c = 0; c < automate->nb_classes; c++ ){
+		l->debuts_entrees[c] = nb;
+		for( int e = 0; e < automate->nb_etats; e++ ){
+			if( ! est_dans_bits( automate->initiaux, e ) ){
+				continue;
+			}
+			const int * debut = 
+				automate->debuts + (size_t) e * automate->nb_classes + c;
+			for( int k = debut[0]; k < debut[1]; k++ ){
+				int fin = automate->fins[k];
+				if( vus->positions[ fin ] != AUCUNE ){
+					continue;
+				}
+				vus->positions[ fin ] = 0;
+				vus->actifs[ vus->nb_actifs++ ] = fin;
+				if( nb == capacite ){
+					capacite *= 2;
+					l->entrees = (int *) xrealloc( 
+						l->entrees, capacite * sizeof(int) 
+					);
+				}
+				l->entrees[ nb++ ] = fin;
+			}
+		}
+		for( int i = 0; i < vus->nb_actifs; i++ ){
+			vus->positions[ vus->actifs[i] ] = AUCUNE;
+		}
+		vus->nb_actifs = 0;
+	}
+	l->debuts_entrees[ automate->nb_classes ] = nb;
+}
+
+static void detruire_lecture( Lecture_positions * l ){
+	detruire_positions( &l->tampons[0] );
+	detruire_positions( &l->tampons[1] );
+	xfree( l->debuts_entrees );
+	xfree( l->entrees );
+}
+
+/*
+ * Lit une lettre ; les chemins qui entrent dans l'automate juste avant 
+ * elle reçoivent la position donnée.
+ */
+static void lire_lettre_positions( 
+	Lecture_positions * l, char lettre, size_t position 
+){
+	const Automate_compile * automate = l->automate;
+	Positions_etats * courant = l->courant;
+	Positions_etats * suivant = l->suivant;
+	int classe = automate->classe[ (uint8_t) lettre ];
+	for( int i = 0; i < courant->nb_actifs; i++ ){
+		int e = courant->actifs[i];
+		size_t debut_chemin = courant->positions[e];
+		courant->positions[e] = AUCUNE;
+		if( classe < 0 ){
+			continue;
+		}
+		const int * debut = 
+			automate->debuts + (size_t) e * automate->nb_classes + classe;
+		for( int k = debut[0]; k < debut[1]; k++ ){
+			garder_position( l, suivant, automate->fins[k], debut_chemin );
+		}
+	}
+	courant->nb_actifs = 0;
+	if( classe >= 0 ){
+		for( 
+			int k = l->debuts_entrees[ classe ]; 
+			k < l->debuts_entrees[ classe + 1 ]; k++ 
+		){
+			garder_position( l, suivant, l->entrees[k], position );
+		}
+	}
+	l->courant = suivant;
+	l->suivant = courant;
+}
+
+/*
+ * La meilleure position (voir garder_position()) d'un chemin qui mène à un
+ * état final, ou AUCUNE ; 'position' est celle de la lecture, pour le 
+ * chemin vide.
+ */
+static size_t position_finale( const Lecture_positions * l, size_t position ){
+	size_t res = l->mot_vide ? position : AUCUNE;
+	const Positions_etats * p = l->courant;
+	for( int i = 0; i < p->nb_actifs; i++ ){
+		int e = p->actifs[i];
+		if( 
+			est_dans_bits( l->automate->finaux, e ) 
+			&& meilleure_position( l, p->positions[e], res )
+		){
+			res = p->positions[e];
+		}
+	}
+	return res;
+}
+
+/*
+ * Lit le texte une fois, en entrant dans l'automate avant chaque lettre : 
+ * chaque état courant garde le plus petit début des chemins qui y mènent.
+ * Quand un état final est courant, une occurrence finit là, et son plus 
+ * petit début est connu.
+ */
+static size_t rechercher_toutes(
+	const Recherche * recherche, const char * texte, size_t taille,
+	void (* action )( size_t debut, size_t fin, void * data ), void * data
+){
+	Lecture_positions lecture;
+	initialiser_lecture( &lecture, recherche->automate, 0 );
+	size_t nb = 0;
+	for( size_t i = 0; ; i++ ){
+		size_t debut = position_finale( &lecture, i );
+		if( debut != AUCUNE ){
+			action( debut, i, data );
+			nb++;
+		}
+		if( i == taille ){
+			break;
+		}
+		lire_lettre_positions( &lecture, texte[i], i );
+	}
+	detruire_lecture( &lecture );
+	return nb;
+}
+
+/*
+ * Lit le texte une fois à l'envers avec le miroir, en y entrant avant 
+ * chaque lettre : chaque état courant garde la plus grande fin des chemins
+ * qui y mènent. On obtient ainsi, pour chaque position, la plus grande fin
+ * d'une occurrence qui y commence. Les occurrences sont ensuite prises de 
+ * gauche à droite : chacune commence à la première position où commence 
+ * une occurrence après la fin de la précédente, et va le plus loin 
+ * possible.
+ */
+static size_t rechercher_plus_longues(
+	const Recherche * recherche, const char * texte, size_t taille,
+	void (* action )( size_t debut, size_t fin, void * data ), void * data
+){
+	Lecture_positions lecture;
+	initialiser_lecture( &lecture, recherche->miroir, 1 );
+	size_t * fins = (size_t *) xmalloc( ( taille + 1 ) * sizeof(size_t) );
+	for( size_t i = taille; ; i-- ){
+		fins[i] = position_finale( &lecture, i );
+		if( i == 0 ){
+			break;
+		}
+		lire_lettre_positions( &lecture, texte[i-1], i );
+	}
+	detruire_lecture( &lecture );
+
+	size_t nb = 0;
+	size_t position = 0;
+	while( position <= taille ){
+		if( fins[ position ] == AUCUNE ){
+			position++;
+			continue;
+		}
+		size_t fin = fins[ position ];
+		action( position, fin, data );
+		nb++;
+		// Après une occurrence vide, on repart de la lettre suivante.
+		position = fin > position ? fin : position + 1;
+	}
+	xfree( fins );
+	return nb;
+}
+
+size_t rechercher(
+	const Recherche * recherche, const char * texte, size_t taille,
+	Politique_recherche politique,
+	void (* action )( size_t debut, size_t fin, void * data ), void * data
+){
+	if( politique == RECHERCHE_TOUTES ){
+		return rechercher_toutes( recherche, texte, taille, action, data );
+	}
+	return rechercher_plus_longues( recherche, texte, taille, action, data );
+}
@@ -0,0 +1,114 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2014, 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file recherche.h */ 
+
+#ifndef __RECHERCHE_H__
+#define __RECHERCHE_H__
+
+#include <stddef.h>
+
+#include "automate.h"
+#include "automate_compile.h"
+
+/**
+ * @brief Les façons de choisir les occurrences renvoyées par rechercher().
+ */
+typedef enum {
+	/**
+	 * Toutes les fins d'occurrences, par ordre croissant. Chacune est 
+	 * renvoyée une fois, avec le plus petit début possible : les 
+	 * occurrences renvoyées peuvent se chevaucher.
+	 */
+	RECHERCHE_TOUTES,
+	/**
+	 * Des occurrences disjointes, choisies comme en POSIX : la première 
+	 * commence le plus à gauche possible et, parmi celles-ci, est la plus 
+	 * longue ; les suivantes sont choisies de même dans la suite du texte.
+	 */
+	RECHERCHE_PLUS_LONGUE_A_GAUCHE
+} Politique_recherche;
+
+/**
+ * @brief Le type d'une recherche des facteurs d'un texte reconnus par un 
+ *        automate.
+ *
+ * Une recherche garde l'automate et son miroir sous forme compilée. Le 
+ * texte est lu en une passe, en ajoutant les états initiaux aux états 
+ * courants avant chaque lettre : c'est comme si l'automate commençait par 
+ * une boucle sur toutes les lettres, sans qu'il faille le reconstruire. 
+ * Chaque état courant garde le plus petit début des chemins qui y mènent. 
+ * Pour les occurrences les plus longues, le texte est lu à l'envers avec 
+ * le miroir de l'automate, et chaque état courant garde la plus grande fin.
+ * Dans les deux cas, chaque lettre n'est lue qu'une fois, en un temps 
+ * O(|Q| + |delta|).
+ *
+ * Une recherche n'est pas modifiée par rechercher() : elle peut être 
+ * partagée en lecture entre plusieurs fils d'exécution.
+ */
+typedef struct Recherche {
+	Automate_compile * automate;
+	Automate_compile * miroir;
+} Recherche;
+
+/**
+ * @brief Prépare la recherche des facteurs reconnus par un automate.
+ *
+ * L'automate peut être modifié ou libéré ensuite.
+ *
+ * @param automate Un automate.
+ * @return La recherche, à libérer avec liberer_recherche().
+ */
+Recherche * creer_recherche( const Automate * automate );
+
+/**
+ * @brief Libère la mémoire d'une recherche.
+ *
+ * @param recherche Une recherche.
+ */
+void liberer_recherche( Recherche * recherche );
+
+/**
+ * @brief Cherche les facteurs d'un texte reconnus par l'automate de la 
+ *        recherche.
+ *
+ * Pour chaque occurrence retenue (voir Politique_recherche), la fonction 
+ * 'action' est appelée avec le début et la fin de l'occurrence : le 
+ * facteur texte[debut], ..., texte[fin-1] est reconnu par l'automate. Si 
+ * l'automate reconnaît le mot vide, on peut avoir debut == fin.
+ *
+ * Le texte n'a pas à se terminer par un '\0', et un '\0' qu'il contient est
+ * lu comme une lettre.
+ *
+ * @param recherche Une recherche.
+ * @param texte Le texte.
+ * @param taille Le nombre de lettres du texte.
+ * @param politique Les occurrences à renvoyer.
+ * @param action La fonction appelée pour chaque occurrence.
+ * @param data La donnée supplémentaire passée en paramètre à 'action'.
+ * @return Le nombre d'occurrences renvoyées.
+ */
+size_t rechercher(
+	const Recherche * recherche, const char * texte, size_t taille,
+	Politique_recherche politique,
+	void (* action )( size_t debut, size_t fin, void * data ), void * data
+);
+
+#endif
@@ -0,0 +1,177 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sous_ensembles.h"
+#include "outils.h"
+
+#include <string.h>
+
+#define NB_ALVEOLES_MIN 64
+
+static uint64_t hacher( const int * elements, int nb ){
+	uint64_t h = 0xcbf29ce484222325ULL ^ (uint64_t) nb;
+	for( int i = 0; i < nb; i++ ){
+		h ^= (uint32_t) elements[i];
+		h *= 0x100000001b3ULL;
+	}
+	// Brassage final, pour que les bits de poids faible, qui servent 
+	// d'indice dans la table, dépendent de tous les éléments.
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return h;
+}
+
+static int est_egal( 
+	const Sous_ensembles * dictionnaire, int i, const int * elements, int nb 
+){
+	size_t debut = dictionnaire->debuts[i];
+	if( dictionnaire->debuts[i+1] - debut != (size_t) nb ){
+		return 0;
+	}
+	return nb == 0 || memcmp( 
+		dictionnaire->elements + debut, elements, nb * sizeof(int) 
+	) == 0;
+}
+
+/*
+ * Renvoie l'alvéole qui contient le sous-ensemble, ou l'alvéole vide où il
+ * devrait être rangé.
+ */
+static size_t chercher_alveole(
+	const Sous_ensembles * dictionnaire, uint64_t h, 
+	const int * elements, int nb
+){
+	size_t masque = dictionnaire->nb_alveoles - 1;
+	size_t a = h & masque;
+	for( ;; a = ( a + 1 ) & masque ){
+		int i = dictionnaire->alveoles[a];
+		if( i < 0 ) return a;
+		if( dictionnaire->hachages[i] == h && est_egal( dictionnaire, i, elements, nb ) ){
+			return a;
+		}
+	}
+}
+
+static void redimensionner_alveoles( Sous_ensembles * dictionnaire, size_t nb_alveoles ){
+	xfree( dictionnaire->alveoles );
+	dictionnaire->nb_alveoles = nb_alveoles;
+	dictionnaire->alveoles = (int *) xmalloc( nb_alveoles * sizeof(int) );
+	memset( dictionnaire->alveoles, -1, nb_alveoles * sizeof(int) );
+	size_t masque = nb_alveoles - 1;
+	for( int i = 0; i < dictionnaire->nb; i++ ){
+		size_t a = dictionnaire->hachages[i] & masque;
+		while( dictionnaire->alveoles[a] >= 0 ){
+			a = ( a + 1 ) & masque;
+		}
+		dictionnaire->alveoles[a] = i;
+	}
+}
+
+void initialiser_sous_ensembles( Sous_ensembles * dictionnaire ){
+	dictionnaire->nb = 0;
+	dictionnaire->capacite = 0;
+	dictionnaire->elements = NULL;
+	dictionnaire->nb_elements = 0;
+	dictionnaire->capacite_elements = 0;
+	dictionnaire->debuts = (size_t *) xmalloc( sizeof(size_t) );
+	dictionnaire->debuts[0] = 0;
+	dictionnaire->hachages = NULL;
+	dictionnaire->alveoles = NULL;
+	redimensionner_alveoles( dictionnaire, NB_ALVEOLES_MIN );
+}
+
+void detruire_sous_ensembles( Sous_ensembles * dictionnaire ){
+	xfree( dictionnaire->elements );
+	xfree( dictionnaire->debuts );
+	xfree( dictionnaire->hachages );
+	xfree( dictionnaire->alveoles );
+}
+
+int trouver_sous_ensemble(
+	const Sous_ensembles * dictionnaire, const int * elements, int nb
+){
+	uint64_t h = hacher( elements, nb );
+	return dictionnaire->alveoles[ 
+		chercher_alveole( dictionnaire, h, elements, nb ) 
+	];
+}
+
+int ajouter_sous_ensemble(
+	Sous_ensembles * dictionnaire, const int * elements, int nb, int * nouveau
+){
+	uint64_t h = hacher( elements, nb );
+	size_t a = chercher_alveole( dictionnaire, h, elements, nb );
+	if( dictionnaire->alveoles[a] >= 0 ){
+		if( nouveau ) *nouveau = 0;
+		return dictionnaire->alveoles[a];
+	}
+	if( nouveau ) *nouveau = 1;
+
+	int i = dictionnaire->nb;
+	if( i == dictionnaire->capacite ){
+		dictionnaire->capacite = dictionnaire->capacite ? 2 * dictionnaire->capacite : 16;
+		dictionnaire->debuts = (size_t *) xrealloc(
+			dictionnaire->debuts, ( dictionnaire->capacite + 1 ) * sizeof(size_t)
+		);
+		dictionnaire->hachages = (uint64_t *) xrealloc(
+			dictionnaire->hachages, dictionnaire->capacite * sizeof(uint64_t)
+		);
+	}
+	if( dictionnaire->nb_elements + nb > dictionnaire->capacite_elements ){
+		size_t capacite = 2 * dictionnaire->capacite_elements;
+		if( capacite < dictionnaire->nb_elements + nb ){
+			capacite = dictionnaire->nb_elements + nb;
+		}
+		dictionnaire->elements = (int *) xrealloc(
+			dictionnaire->elements, ( capacite + 1 ) * sizeof(int)
+		);
+		dictionnaire->capacite_elements = capacite;
+	}
+	if( nb > 0 ){
+		memcpy( 
+			dictionnaire->elements + dictionnaire->nb_elements, elements, 
+			nb * sizeof(int) 
+		);
+	}
+	dictionnaire->nb_elements += nb;
+	dictionnaire->debuts[i+1] = dictionnaire->nb_elements;
+	dictionnaire->hachages[i] = h;
+	dictionnaire->alveoles[a] = i;
+	dictionnaire->nb++;
+
+	// On garde la table remplie au plus à moitié.
+	if( 2 * (size_t) dictionnaire->nb > dictionnaire->nb_alveoles ){
+		redimensionner_alveoles( dictionnaire, 2 * dictionnaire->nb_alveoles );
+	}
+	return i;
+}
+
+const int * get_sous_ensemble(
+	const Sous_ensembles * dictionnaire, int i, int * nb
+){
+	size_t debut = dictionnaire->debuts[i];
+	*nb = dictionnaire->debuts[i+1] - debut;
+	return dictionnaire->elements + debut;
+}
+
+int nb_sous_ensembles( const Sous_ensembles * dictionnaire ){
+	return dictionnaire->nb;
+}
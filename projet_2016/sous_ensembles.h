@@ -0,0 +1,98 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux.
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __SOUS_ENSEMBLES_H__
+#define __SOUS_ENSEMBLES_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Définit le type d'un dictionnaire de sous-ensembles d'entiers.
+ *
+ * Chaque sous-ensemble ajouté au dictionnaire reçoit un numéro : 0 pour le 
+ * premier, 1 pour le suivant, etc. Ajouter une seconde fois le même 
+ * sous-ensemble renvoie le numéro déjà attribué.
+ *
+ * Les sous-ensembles sont rangés sous forme de tableaux triés, mis bout à 
+ * bout dans un seul tableau. Le hachage de chaque sous-ensemble est calculé
+ * une fois pour toutes : deux sous-ensembles ne sont comparés élément par 
+ * élément que si leurs hachages sont égaux.
+ *
+ * La structure est publique pour pouvoir être incluse dans une autre 
+ * structure, mais ses champs ne doivent pas être manipulés directement.
+ */
+typedef struct Sous_ensembles {
+	int nb;
+	int capacite;
+	int * elements;
+	size_t nb_elements;
+	size_t capacite_elements;
+	size_t * debuts;
+	uint64_t * hachages;
+	int * alveoles;
+	size_t nb_alveoles;
+} Sous_ensembles;
+
+/*
+ * Initialise un dictionnaire vide.
+ */
+void initialiser_sous_ensembles( Sous_ensembles * dictionnaire );
+
+/*
+ * Libère la mémoire d'un dictionnaire initialisé par 
+ * initialiser_sous_ensembles().
+ */
+void detruire_sous_ensembles( Sous_ensembles * dictionnaire );
+
+/*
+ * Renvoie le numéro du sous-ensemble formé des 'nb' entiers de 'elements',
+ * qui doivent être deux à deux distincts et triés par ordre croissant.
+ *
+ * Si le sous-ensemble n'était pas encore dans le dictionnaire, il y est 
+ * copié, reçoit le numéro suivant et *nouveau est mis à 1. Sinon *nouveau
+ * est mis à 0. 'nouveau' peut être NULL.
+ */
+int ajouter_sous_ensemble(
+	Sous_ensembles * dictionnaire, const int * elements, int nb, int * nouveau
+);
+
+/*
+ * Renvoie le numéro du sous-ensemble, ou -1 s'il n'est pas dans le 
+ * dictionnaire.
+ */
+int trouver_sous_ensemble(
+	const Sous_ensembles * dictionnaire, const int * elements, int nb
+);
+
+/*
+ * Renvoie les éléments triés du sous-ensemble numéro i et écrit leur nombre
+ * dans *nb. Le pointeur renvoyé n'est valide que jusqu'au prochain ajout.
+ */
+const int * get_sous_ensemble(
+	const Sous_ensembles * dictionnaire, int i, int * nb
+);
+
+/*
+ * Renvoie le nombre de sous-ensembles du dictionnaire.
+ */
+int nb_sous_ensembles( const Sous_ensembles * dictionnaire );
+
+#endif
@@ -22,16 +22,26 @@
 #include "outils.h"
 #include "fifo.h"
 #include "avl.h"
+#include "pool.h"
 
 #include <assert.h>
 
 #include <search.h>
+#include <stddef.h>
 #include <stdlib.h>
 
+/*
+ * Les associations, les noeuds de l'arbre AVL et l'arbre lui-même sont 
+ * alloués dans le pool de la table. Les fonctions de manipulation des clés
+ * ne sont stockées qu'une fois, dans la table, qui est passée en paramètre
+ * aux fonctions de comparaison de libavl.
+ *
+ * Le pool est en général celui de la table (pool_propre). Une table créée
+ * par creer_table_dans_pool() utilise un pool partagé : elle est alors 
+ * elle-même allouée dans ce pool, sans son champ pool_propre, qui doit donc
+ * rester le dernier champ de la structure.
+ */
 typedef struct Table_association {
-	void (*supprimer_cle)(intptr_t cle);
-	intptr_t (*copier_cle)(const intptr_t cle);
-	int (*comparer_cle)(const intptr_t cle1, const intptr_t cle2);
 	intptr_t cle;
 	intptr_t valeur;
 } Table_association ;
@@ -41,8 +51,14 @@ struct Table {
 	intptr_t (*copier_cle)( const intptr_t cle );
 	void (*supprimer_cle)(intptr_t cle);
 	struct avl_table * root;
+	Pool * pool;
+	Pool pool_propre;
 };
 
+static int pool_est_partage( const Table* table ){
+	return table->pool != &table->pool_propre;
+}
+
 
 intptr_t get_cle( Table_iterateur it ){
 	const Table_association * asso = ( const Table_association * ) avl_t_cur( &it );
@@ -55,10 +71,10 @@ intptr_t get_valeur( Table_iterateur it ){
 }
 
 Table_association * creer_table_association(
-	const Table* table, const intptr_t cle, intptr_t valeur
+	Table* table, const intptr_t cle, intptr_t valeur
 ){
-	Table_association * res = xmalloc(
-		sizeof( Table_association )
+	Table_association * res = allouer_pool(
+		table->pool, sizeof( Table_association )
 	);
 	if( table->copier_cle && cle ){
 		res->cle = table->copier_cle( cle );
@@ -66,28 +82,15 @@ Table_association * creer_table_association(
 		res->cle = cle;
 	}
 	res->valeur = valeur;
-	res->supprimer_cle = table->supprimer_cle;
-	res->copier_cle = table->copier_cle;
-	res->comparer_cle = table->comparer_cle;
-	return res;
-}
-
-Table_association * copier_table_association( Table_association * asso ){
-	Table_association * res = xmalloc(
-		sizeof( Table_association )
-	);
-	*res = *asso;
-	if( asso->copier_cle && asso->cle ){
-		res->cle = asso->copier_cle( asso->cle );
-	}
 	return res;
 }
 
 int compare_table_association( const void * pa1, const void * pb1, void* param ){
+	const Table * table = (const Table *) param;
 	Table_association * pa = (Table_association *) pa1;
 	Table_association * pb = (Table_association *) pb1;
-	if( pa->comparer_cle ){
-		int r = pa->comparer_cle( pa->cle, pb->cle );
+	if( table->comparer_cle ){
+		int r = table->comparer_cle( pa->cle, pb->cle );
 		return r;
 	}else{
 		if( pa->cle < pb->cle )
@@ -98,20 +101,65 @@ int compare_table_association( const void * pa1, const void * pb1, void* param )
 	}
 }
 
+void supprimer_table_association( Table* table, Table_association * asso ){
+	if( table->supprimer_cle && asso->cle ){
+		table->supprimer_cle( asso->cle );
+	}
+	rendre_pool( table->pool, asso, sizeof( Table_association ) );
+}
 
-void supprimer_table_association2( void* asso_tmp, void* data ){
-	Table_association * asso = (Table_association*) asso_tmp;
-	if( asso->supprimer_cle && asso->cle ){
-		asso->supprimer_cle( asso->cle );
+/*
+ * Libère les clés de toutes les associations de la table, sans toucher aux
+ * noeuds : ceux-ci sont rendus en bloc avec le pool.
+ */
+static void supprimer_cles( Table* table ){
+	if( ! table->supprimer_cle ){
+		return;
+	}
+	struct avl_traverser traverser;
+	Table_association * asso;
+	avl_t_init( &traverser, table->root );
+	while( (asso = avl_t_next( &traverser )) ){
+		if( asso->cle ){
+			table->supprimer_cle( asso->cle );
+		}
 	}
-	xfree(asso);
 }
 
-void supprimer_table_association( Table_association * asso ){
-	if( asso->supprimer_cle && asso->cle ){
-		asso->supprimer_cle( asso->cle );
+void supprimer_table_association2( void* asso, void* table ){
+	supprimer_table_association( (Table*) table, (Table_association*) asso );
+}
+
+static void creer_arbre( Table* table ){
+	table->root = avl_create(
+		compare_table_association, table, allocateur_avl_pool( table->pool )
+	);
+}
+
+/*
+ * Vide l'arbre de la table. Si le pool est à la table, il est rendu en bloc.
+ * Sinon, les noeuds et les associations sont rendus un par un au pool 
+ * partagé, qui peut encore servir à d'autres structures.
+ */
+static void detruire_arbre( Table* table ){
+	if( pool_est_partage( table ) ){
+		avl_destroy( table->root, supprimer_table_association2 );
+	}else{
+		supprimer_cles( table );
+		vider_pool( table->pool );
 	}
-	xfree(asso);
+}
+
+static void initialiser_table(
+	Table* table,
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+){
+	creer_arbre( table );
+	table->supprimer_cle = supprimer_cle;
+	table->comparer_cle = comparer_cle;
+	table->copier_cle = copier_cle;
 }
 
 Table* creer_table(
@@ -120,49 +168,89 @@ Table* creer_table(
 	void (*supprimer_cle)(intptr_t cle)
 ){
 	Table* res = xmalloc( sizeof(Table) );
-	res->root = avl_create ( compare_table_association, NULL, NULL );
+	initialiser_pool( &res->pool_propre );
+	res->pool = &res->pool_propre;
+	initialiser_table( res, comparer_cle, copier_cle, supprimer_cle );
+	return res;
+}
 
-	res->supprimer_cle = supprimer_cle;
-	res->comparer_cle = comparer_cle;
-	res->copier_cle = copier_cle;
+Table* creer_table_dans_pool(
+	Pool* pool,
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+){
+	Table* res = allouer_pool( pool, offsetof( Table, pool_propre ) );
+	res->pool = pool;
+	initialiser_table( res, comparer_cle, copier_cle, supprimer_cle );
 	return res;
 }
 
 void liberer_table( Table* table ){
 	assert( table );
-	avl_destroy ( table->root, supprimer_table_association2 );
-	xfree( table );
+	detruire_arbre( table );
+	if( pool_est_partage( table ) ){
+		rendre_pool( table->pool, table, offsetof( Table, pool_propre ) );
+	}else{
+		xfree( table );
+	}
+}
+
+/*
+ * Initialise une association de recherche, allouée par l'appelant (en général
+ * sur la pile), qui emprunte la clé passée en paramètre au lieu de la copier.
+ * Une telle sonde ne sert qu'à comparer : elle ne doit jamais rester dans 
+ * l'arbre ni être passée à supprimer_table_association().
+ */
+static void initialiser_sonde( Table_association * sonde, const intptr_t cle ){
+	sonde->cle = cle;
+	sonde->valeur = (intptr_t) NULL;
 }
 
 void add_table( Table* table, const intptr_t cle, intptr_t valeur ) {
-	Table_association* asso = creer_table_association(table, cle, valeur);
-	void* val = avl_probe ( table->root, (void*) asso );
+	Table_association sonde;
+	initialiser_sonde( &sonde, cle );
+	void** val = avl_probe ( table->root, (void*) &sonde );
 	if( val == NULL ){
 		ERREUR( "Espace insuffisant" );
 	}
-	Table_association* asso_tree = *( Table_association** ) val; 
-	if( asso_tree != asso  ){
-		supprimer_table_association( asso );
-		asso_tree->valeur = valeur;
+	if( *val == (void*) &sonde ){
+		// La clé est nouvelle : on remplace la sonde par une vraie 
+		// association, la copie de la clé n'est faite qu'à ce moment-là.
+		*val = creer_table_association( table, cle, valeur );
+	}else{
+		( *( Table_association** ) val )->valeur = valeur;
+	}
+}
+
+void remplir_table_triee(
+	Table* table, const intptr_t* cles, const intptr_t* valeurs, size_t nb
+){
+	if( avl_count( table->root ) != 0 ){
+		ERREUR( "La table doit être vide" );
+	}
+	if( nb == 0 ) return;
+	void** associations = (void**) xmalloc( nb * sizeof(void*) );
+	for( size_t i = 0; i < nb; i++ ){
+		associations[i] = creer_table_association(
+			table, cles[i], valeurs ? valeurs[i] : (intptr_t) NULL
+		);
+	}
+	if( ! avl_build_sorted( table->root, associations, nb ) ){
+		ERREUR( "Espace insuffisant" );
 	}
+	xfree( associations );
 }
 
 intptr_t delete_table( Table* table, intptr_t cle ){
 	intptr_t valeur = (intptr_t) NULL;
-	Table_association* asso_tree = NULL;
-	Table_association* asso = creer_table_association(
-		table, cle, (intptr_t) NULL
-	);
-	void* val = avl_find( table->root, (void*) asso );
-	if( val ){
-		asso_tree = ( Table_association* ) val; 
+	Table_association sonde;
+	initialiser_sonde( &sonde, cle );
+	Table_association* asso_tree = avl_delete( table->root, (void*) &sonde );
+	if( asso_tree ){
 		valeur = asso_tree->valeur;
+		supprimer_table_association( table, asso_tree );
 	}
-	avl_delete( table->root, (void*) asso );
-	if(asso_tree){
-		supprimer_table_association( asso_tree );
-	}
-	supprimer_table_association( asso );
 	return valeur;
 }
 
@@ -199,8 +287,8 @@ void pour_toute_valeur_table(
 }
 
 void vider_table( Table* table ){
-	avl_destroy ( table->root, supprimer_table_association2 );
-	table->root = avl_create ( compare_table_association, NULL, NULL );
+	detruire_arbre( table );
+	creer_arbre( table );
 }
 
 typedef struct {
@@ -240,14 +328,35 @@ void print_table(
 
 Table_iterateur trouver_table( const Table* table, intptr_t cle ){
 	Table_iterateur it;
-	Table_association* asso = creer_table_association(
-		table, cle, (intptr_t) NULL
-	);
-	avl_t_find( &it, table->root, (void*) asso );
-	supprimer_table_association( asso );
+	Table_association sonde;
+	initialiser_sonde( &sonde, cle );
+	avl_t_find( &it, table->root, (void*) &sonde );
 	return it;
 }
 
+Table_iterateur trouver_table_a_partir( const Table* table, intptr_t cle ){
+	Table_iterateur it;
+	Table_association sonde;
+	initialiser_sonde( &sonde, cle );
+	avl_t_find_ge( &it, table->root, (void*) &sonde );
+	return it;
+}
+
+int trouver_valeur_table(
+	const Table* table, const intptr_t cle, intptr_t * valeur
+){
+	Table_association sonde;
+	initialiser_sonde( &sonde, cle );
+	Table_association * asso = avl_find( table->root, (void*) &sonde );
+	if( ! asso ){
+		return 0;
+	}
+	if( valeur ){
+		*valeur = asso->valeur;
+	}
+	return 1;
+}
+
 Table_iterateur premier_iterateur_table( const Table* table ){
 	Table_iterateur it;
 	avl_t_first( &it, table->root );
@@ -276,15 +385,6 @@ Table_iterateur iterateur_precedent_table( Table_iterateur iterateur ){
 	return iterateur;
 }
 
-int taille_table( Table* t ){
-	int res = 0;
-	Table_iterateur it1;
-	for(
-		it1 = premier_iterateur_table( t );
-		! iterateur_est_vide( it1 );
-		it1 = iterateur_suivant_table( it1 )
-	){
-		res += 1;
-	}
-	return res;
-};
+int taille_table( const Table* t ){
+	return avl_count( t->root );
+}
@@ -25,6 +25,7 @@
 
 #include <stdint.h>
 #include "avl.h"
+#include "pool.h"
 
 /**
  * @brief Définit le type d'une table.
@@ -150,6 +151,27 @@ Table* creer_table(
 	void (*supprimer_cle)(intptr_t cle)
 );
 
+/**
+ * @brief
+ * Renvoie une nouvelle table dont toute la mémoire (la table elle-même,
+ * ses noeuds et ses associations) est prise dans le pool passé en paramètre.
+ *
+ * Les paramètres 'comparer_cle', 'copier_cle' et 'supprimer_cle' ont le même
+ * sens que pour creer_table(). Si 'copier_cle' est NULL, la table conserve
+ * la clé passée à add_table() telle quelle : l'appelant peut ainsi allouer 
+ * ses clés dans le même pool.
+ *
+ * La table peut être détruite par liberer_table(), qui rend sa mémoire au
+ * pool, ou simplement abandonnée si le pool est détruit par vider_pool() ou
+ * liberer_pool() : aucun free() n'est fait pour la table dans ce cas.
+ */
+Table* creer_table_dans_pool(
+	Pool* pool,
+	int (*comparer_cle)( const intptr_t cle1, const intptr_t cle2 ),
+	intptr_t (*copier_cle)( const intptr_t cle ),
+	void (*supprimer_cle)(intptr_t cle)
+);
+
 /**
  * @brief
  * Cette fonction détruit une table. La mémoire qui a été allouée par la table 
@@ -176,6 +198,19 @@ void liberer_table( Table* table );
  */
 void add_table( Table* table, const intptr_t cle, const intptr_t valeur );
 
+/**
+ * @brief
+ * Remplit une table vide avec 'nb' associations en temps linéaire.
+ *
+ * Les clés doivent être deux à deux distinctes et triées par ordre croissant
+ * pour la fonction de comparaison des clés de la table. Elles sont copiées
+ * comme dans add_table(). Si 'valeurs' vaut NULL, toutes les valeurs sont
+ * NULL.
+ */
+void remplir_table_triee(
+	Table* table, const intptr_t* cles, const intptr_t* valeurs, size_t nb
+);
+
 
 /**
  * @brief
@@ -257,6 +292,34 @@ void pour_toute_cle_valeur_table(
  */
 Table_iterateur trouver_table( const Table* table, const intptr_t cle );
 
+/**
+ * @brief
+ * Renvoie un itérateur positionné sur la plus petite association dont la clé
+ * est supérieure ou égale à la clé passée en paramètre, ou l'itérateur vide
+ * s'il n'y en a pas.
+ *
+ * Avec iterateur_suivant_table(), on parcourt ainsi les associations dont 
+ * les clés sont comprises entre deux bornes, sans parcourir toute la table.
+ * Comme trouver_table(), cette fonction ne copie pas la clé passée en 
+ * paramètre.
+ */
+Table_iterateur trouver_table_a_partir( const Table* table, const intptr_t cle );
+
+/**
+ * @brief
+ * Cherche la clé passée en paramètre dans la table. Renvoie 1 si elle s'y
+ * trouve et 0 sinon. Si la clé est présente et que 'valeur' n'est pas NULL,
+ * la valeur associée à la clé est écrite dans *valeur.
+ *
+ * Contrairement à trouver_table(), cette fonction ne construit pas 
+ * d'itérateur. Ni trouver_table() ni trouver_valeur_table() ne copient la clé
+ * passée en paramètre : on peut leur donner l'adresse d'une clé allouée sur la
+ * pile, aucune allocation n'est faite pendant la recherche.
+ */
+int trouver_valeur_table(
+	const Table* table, const intptr_t cle, intptr_t * valeur
+);
+
 /**
  * @brief
  * Renvoie un itérateur positionné sur la première association de la table.
@@ -321,6 +384,6 @@ intptr_t get_valeur( Table_iterateur it );
  * @brief
  * Renvoie la taille de la table.
  */
-int taille_table( Table* t );
+int taille_table( const Table* t );
 
 #endif
@@ -0,0 +1,151 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+static int sont_les_antecedents(
+	const Automate * automate, int fin, char lettre, int a, int b
+){
+	const Ensemble * ens = antecedents( automate, fin, lettre );
+	return 
+		taille_ensemble( ens ) == ( a == b ? 1 : 2 )
+		&& est_dans_l_ensemble( ens, a )
+		&& est_dans_l_ensemble( ens, b );
+}
+
+int test_antecedents( Automate * automate ){
+	int result = 1;
+
+	ajouter_transition( automate, 1, 'a', 2 );
+	ajouter_transition( automate, 3, 'a', 2 );
+	indexer_antecedents( automate );
+	// Les transitions ajoutées après la construction sont indexées.
+	ajouter_transition( automate, 2, 'b', 3 );
+	ajouter_transition( automate, 3, 'b', 3 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	indexer_antecedents( automate );
+
+	TEST( sont_les_antecedents( automate, 2, 'a', 1, 3 ), result );
+	TEST( sont_les_antecedents( automate, 3, 'b', 2, 3 ), result );
+	TEST( sont_les_antecedents( automate, 2, 'b', 1, 1 ), result );
+	TEST( taille_ensemble( antecedents( automate, 1, 'a' ) ) == 0, result );
+	TEST( taille_ensemble( antecedents( automate, 42, 'c' ) ) == 0, result );
+
+	// Un automate vidé garde son index.
+	vider_automate( automate );
+	TEST( taille_ensemble( antecedents( automate, 2, 'a' ) ) == 0, result );
+	ajouter_transition( automate, 5, 'c', 6 );
+	TEST( sont_les_antecedents( automate, 6, 'c', 5, 5 ), result );
+
+	return result;
+}
+
+int test_miroir_indexe(){
+	int result = 1;
+
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 1, 'b', 1 );
+	ajouter_transition( automate, 2, 'c', 0 );
+	ajouter_etat( automate, 7 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+
+	Automate * sans_index = miroir( automate );
+	indexer_antecedents( automate );
+	Automate * avec_index = miroir( automate );
+
+	TEST(
+		1
+		&& le_mot_est_reconnu( avec_index, "bba" )
+		&& le_mot_est_reconnu( avec_index, "bacbba" )
+		&& ! le_mot_est_reconnu( avec_index, "abb" )
+		&& est_un_etat_de_l_automate( avec_index, 7 )
+		&& est_une_transition_de_l_automate( avec_index, 1, 'a', 0 )
+		&& est_une_transition_de_l_automate( avec_index, 2, 'b', 1 )
+		&& ! est_une_transition_de_l_automate( avec_index, 0, 'a', 1 )
+		, result
+	);
+	TEST(
+		1
+		&& le_mot_est_reconnu( sans_index, "bba" )
+		&& est_une_transition_de_l_automate( sans_index, 2, 'b', 1 )
+		, result
+	);
+
+	miroir_en_place( automate );
+	TEST(
+		1
+		&& le_mot_est_reconnu( automate, "bba" )
+		&& ! le_mot_est_reconnu( automate, "abb" )
+		&& est_un_etat_initial_de_l_automate( automate, 2 )
+		&& est_un_etat_final_de_l_automate( automate, 0 )
+		&& sont_les_antecedents( automate, 1, 'b', 1, 2 )
+		, result
+	);
+	// Le miroir du miroir est l'automate de départ.
+	miroir_en_place( automate );
+	TEST(
+		1
+		&& le_mot_est_reconnu( automate, "abb" )
+		&& ! le_mot_est_reconnu( automate, "bba" )
+		&& sont_les_antecedents( automate, 0, 'c', 2, 2 )
+		, result
+	);
+
+	// Sans index, miroir_en_place() le construit.
+	Automate * arena = creer_automate_arena();
+	ajouter_transition( arena, 0, 'a', 1 );
+	ajouter_etat_initial( arena, 0 );
+	ajouter_etat_final( arena, 1 );
+	miroir_en_place( arena );
+	ajouter_transition( arena, 1, 'b', 1 );
+	TEST(
+		1
+		&& le_mot_est_reconnu( arena, "ba" )
+		&& sont_les_antecedents( arena, 0, 'a', 1, 1 )
+		&& sont_les_antecedents( arena, 1, 'b', 1, 1 )
+		, result
+	);
+
+	liberer_automate( arena );
+	liberer_automate( sans_index );
+	liberer_automate( avec_index );
+	liberer_automate( automate );
+	return result;
+}
+
+
+int main(){
+
+	Automate * automate = creer_automate();
+	Automate * arena = creer_automate_arena();
+	int result = test_antecedents( automate ) && test_antecedents( arena );
+	liberer_automate( arena );
+	liberer_automate( automate );
+	if( ! result ){ return 1; };
+	if( ! test_miroir_indexe() ){ return 1; };
+
+	return 0;
+	
+}
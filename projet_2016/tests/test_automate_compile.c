@@ -0,0 +1,384 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "automate_compile.h"
+#include "outils.h"
+
+#include <string.h>
+
+
+int test_compiler_automate(){
+	int result = 1;
+
+	Automate* automate = creer_automate();
+	ajouter_transition( automate, 3, 'a', 5 );
+	ajouter_transition( automate, 5, 'b', 3 );
+	ajouter_transition( automate, 5, 'a', 5 );
+	ajouter_transition( automate, 5, 'a', -2 );
+	ajouter_transition( automate, 5, 'c', 600 );
+	ajouter_etat( automate, 42 );
+	ajouter_etat_initial( automate, 3 );
+	ajouter_etat_final( automate, 600 );
+
+	Automate_compile * compile = compiler_automate( automate );
+
+	TEST(
+		1
+		&& compile->nb_etats == 5
+		&& compile->nb_lettres == 3
+		&& compile->etats[0] == -2
+		&& compile->etats[4] == 600
+		&& indice_etat_compile( compile, 42 ) == 3
+		&& indice_etat_compile( compile, 4 ) == -1
+		&& compile->indice_lettre['d'] == -1
+		&& compile->lettres[ compile->indice_lettre['b'] ] == 'b'
+		&& compile->nb_classes == 3
+		&& compile->classe['d'] == -1
+		, result
+	);
+
+	// Les fins d'une même liste sont triées.
+	int e = indice_etat_compile( compile, 5 );
+	int l = compile->classe['a'];
+	int * debut = compile->debuts + e * compile->nb_classes + l;
+	TEST(
+		1
+		&& debut[1] - debut[0] == 2
+		&& compile->etats[ compile->fins[ debut[0] ] ] == -2
+		&& compile->etats[ compile->fins[ debut[0] + 1 ] ] == 5
+		, result
+	);
+
+	liberer_automate( automate );
+
+	Ensemble * etat_courant = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( etat_courant, 3 ); 
+
+	deplacer_ensemble( etat_courant, delta_compile( compile, etat_courant, 'a' ) );
+	TEST(
+		1
+		&& est_dans_l_ensemble( etat_courant, 5 )
+		&& taille_ensemble( etat_courant ) == 1
+		, result
+	);
+
+	deplacer_ensemble( 
+		etat_courant, delta_star_compile( compile, etat_courant, "aa" ) 
+	);
+	TEST(
+		1
+		&& est_dans_l_ensemble( etat_courant, 5 )
+		&& est_dans_l_ensemble( etat_courant, -2 )
+		&& taille_ensemble( etat_courant ) == 2
+		, result
+	);
+
+	deplacer_ensemble( 
+		etat_courant, delta_star_compile( compile, etat_courant, "c" ) 
+	);
+	TEST(
+		1
+		&& est_dans_l_ensemble( etat_courant, 600 )
+		&& taille_ensemble( etat_courant ) == 1
+		, result
+	);
+
+	deplacer_ensemble( 
+		etat_courant, delta_star_compile( compile, etat_courant, "cd" ) 
+	);
+	TEST( taille_ensemble( etat_courant ) == 0, result );
+
+	TEST( le_mot_est_reconnu_compile( compile, "ac" ), result );
+	TEST( le_mot_est_reconnu_compile( compile, "ababaac" ), result );
+	TEST( ! le_mot_est_reconnu_compile( compile, "" ), result );
+	TEST( ! le_mot_est_reconnu_compile( compile, "ab" ), result );
+	TEST( ! le_mot_est_reconnu_compile( compile, "acc" ), result );
+	TEST( ! le_mot_est_reconnu_compile( compile, "ax" ), result );
+
+	liberer_ensemble( etat_courant );
+	liberer_automate_compile( compile );
+
+	return result;
+}
+
+int test_compiler_grand_automate(){
+	int result = 1;
+
+	// Plus de 1024 états : les ensembles de travail sont alloués.
+	const char * mot = "abcabcabcabcabcabcabcabcabcabcabcabcabcabcabcabcabc";
+	Automate * automate = mot_to_automate( mot );
+	for( int i=0; i<2000; i++ ){
+		ajouter_transition( automate, 1000 + i, 'a', 1001 + i );
+	}
+	Automate_compile * compile = compiler_automate( automate );
+
+	TEST( compile->nb_etats == taille_ensemble( get_etats( automate ) ), result );
+	TEST( le_mot_est_reconnu_compile( compile, mot ), result );
+	TEST( ! le_mot_est_reconnu_compile( compile, "abc" ), result );
+	TEST( 
+		le_mot_est_reconnu( automate, mot ) == 
+		le_mot_est_reconnu_compile( compile, mot ), 
+		result 
+	);
+
+	liberer_automate_compile( compile );
+	liberer_automate( automate );
+
+	// Automate vide.
+	automate = creer_automate();
+	compile = compiler_automate( automate );
+	TEST( ! le_mot_est_reconnu_compile( compile, "" ), result );
+	TEST( ! le_mot_est_reconnu_compile( compile, "a" ), result );
+	liberer_automate_compile( compile );
+	liberer_automate( automate );
+
+	return result;
+}
+
+/*
+ * Reconnaît les mots de longueur au moins n dont la n-ième lettre avant la
+ * fin est un 'a'. Si 'sens' vaut -1, les états sont numérotés à l'envers : 
+ * les transitions ne vont plus de e à e+1.
+ */
+Automate * creer_automate_nieme_lettre( int n, int sens ){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', sens );
+	for( int i = 1; i < n; i++ ){
+		ajouter_transition( automate, sens * i, 'a', sens * ( i+1 ) );
+		ajouter_transition( automate, sens * i, 'b', sens * ( i+1 ) );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, sens * n );
+	return automate;
+}
+
+int test_compiler_masques(){
+	int result = 1;
+	char mot[201];
+
+	// Plus de 64 états : les masques tiennent sur plusieurs mots.
+	for( int sens = -1; sens <= 1; sens += 2 ){
+		Automate * automate = creer_automate_nieme_lettre( 100, sens );
+		Automate_compile * compile = compiler_automate( automate );
+		TEST( compile->nb_mots == 2, result );
+		if( sens == 1 ){
+			TEST( compile->avances && compile->boucles && ! compile->masques, result );
+		}else{
+			TEST( compile->masques && ! compile->avances, result );
+		}
+
+		memset( mot, 'b', 200 );
+		mot[200] = '\0';
+		mot[100] = 'a';
+		TEST( le_mot_est_reconnu_compile( compile, mot ), result );
+		TEST( le_mot_est_reconnu_compile( compile, mot + 100 ), result );
+		TEST( ! le_mot_est_reconnu_compile( compile, mot + 101 ), result );
+		mot[199] = '\0';
+		TEST( ! le_mot_est_reconnu_compile( compile, mot ), result );
+		mot[199] = 'b';
+		mot[150] = 'c';
+		TEST( ! le_mot_est_reconnu_compile( compile, mot ), result );
+		mot[150] = 'b';
+
+		Ensemble * etats = creer_ensemble( NULL, NULL, NULL );
+		ajouter_element( etats, 0 );
+		deplacer_ensemble( etats, delta_star_compile( compile, etats, mot ) );
+		TEST( 
+			1
+			&& taille_ensemble( etats ) == 2 
+			&& est_dans_l_ensemble( etats, 0 )
+			&& est_dans_l_ensemble( etats, 100 * sens )
+			, result 
+		);
+
+		// Après 110 'a', les 101 états sont actifs.
+		char * a = mot + 90;
+		memset( a, 'a', 110 );
+		deplacer_ensemble( etats, delta_star_compile( compile, etats, a ) );
+		TEST( taille_ensemble( etats ) == 101, result );
+		deplacer_ensemble( etats, delta_compile( compile, etats, 'b' ) );
+		TEST( 
+			1
+			&& taille_ensemble( etats ) == 100 
+			&& est_dans_l_ensemble( etats, 100 * sens )
+			&& ! est_dans_l_ensemble( etats, sens )
+			, result 
+		);
+		deplacer_ensemble( etats, delta_compile( compile, etats, '\0' ) );
+		TEST( taille_ensemble( etats ) == 0, result );
+
+		// Les fonctions de automate.h passent par la forme compilée.
+		memset( mot, 'b', 200 );
+		mot[100] = 'a';
+		TEST( le_mot_est_reconnu( automate, mot ), result );
+		TEST( ! le_mot_est_reconnu( automate, mot + 101 ), result );
+		ajouter_element( etats, 0 );
+		deplacer_ensemble( etats, delta_star( automate, etats, mot ) );
+		TEST( taille_ensemble( etats ) == 2, result );
+
+		liberer_ensemble( etats );
+		liberer_automate_compile( compile );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int test_reconnaitre_mots(){
+	int result = 1;
+	size_t n = 5000;
+	char ** mots = xmalloc( n * sizeof(char *) );
+	int * resultats = xmalloc( n * sizeof(int) );
+	unsigned int graine = 42;
+	for( size_t i = 0; i < n; i++ ){
+		int taille = i % 40;
+		mots[i] = xmalloc( taille + 1 );
+		for( int j = 0; j < taille; j++ ){
+			graine = graine * 1103515245u + 12345u;
+			mots[i][j] = "abc"[ ( graine >> 16 ) % 3 ];
+		}
+		mots[i][taille] = '\0';
+	}
+
+	// Un petit automate, lu par masques, et un grand, lu par listes.
+	Automate * automates[2];
+	automates[0] = creer_automate_nieme_lettre( 5, -1 );
+	automates[1] = creer_automate_nieme_lettre( 5, 1 );
+	for( int i = 0; i < 2000; i++ ){
+		ajouter_transition( automates[1], 1000 + i, 'a', 1001 + i );
+	}
+
+	for( int k = 0; k < 2; k++ ){
+		Automate_compile * compile = compiler_automate( automates[k] );
+		int nb_threads[] = { 1, 3, 0 };
+		for( int t = 0; t < 3; t++ ){
+			memset( resultats, -1, n * sizeof(int) );
+			reconnaitre_mots( 
+				automates[k], (const char * const *) mots, n, resultats, 
+				nb_threads[t] 
+			);
+			int identiques = 1;
+			for( size_t i = 0; i < n; i++ ){
+				identiques &= 
+					resultats[i] == le_mot_est_reconnu_compile( compile, mots[i] );
+			}
+			TEST( identiques, result );
+		}
+		// Aucun mot.
+		reconnaitre_mots_compile( 
+			compile, (const char * const *) mots, 0, resultats, 4 
+		);
+		liberer_automate_compile( compile );
+		liberer_automate( automates[k] );
+	}
+
+	for( size_t i = 0; i < n; i++ ){
+		xfree( mots[i] );
+	}
+	xfree( mots );
+	xfree( resultats );
+	return result;
+}
+
+int test_octets_et_classes(){
+	int result = 1;
+
+	// Les octets 0 et 0xE9 sont des lettres comme les autres.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, (char) 0xE9, 1 );
+	ajouter_transition( automate, 1, '\0', 2 );
+	ajouter_transition( automate, 2, 'a', 2 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+	const uint8_t mot[] = { 0xE9, 0x00, 'a', 'a' };
+	const uint8_t autre[] = { 0xE9, 0x01 };
+	TEST( le_mot_est_reconnu_octets( automate, mot, 2 ), result );
+	TEST( le_mot_est_reconnu_octets( automate, mot, 4 ), result );
+	TEST( ! le_mot_est_reconnu_octets( automate, mot, 1 ), result );
+	TEST( ! le_mot_est_reconnu_octets( automate, autre, 2 ), result );
+	Ensemble * etats = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( etats, 0 );
+	deplacer_ensemble( etats, delta_star_octets( automate, etats, mot, 3 ) );
+	TEST( 
+		taille_ensemble( etats ) == 1 && est_dans_l_ensemble( etats, 2 ), 
+		result 
+	);
+
+	Automate_compile * compile = compiler_automate( automate );
+	TEST( le_mot_est_reconnu_octets_compile( compile, mot, 4 ), result );
+	TEST( ! le_mot_est_reconnu_octets_compile( compile, autre, 2 ), result );
+	liberer_automate_compile( compile );
+	liberer_automate( automate );
+
+	// Les mots qui contiennent un x : les 25 autres lettres ne forment 
+	// qu'une classe.
+	automate = creer_automate();
+	for( char lettre = 'a'; lettre <= 'z'; lettre++ ){
+		ajouter_transition( automate, 0, lettre, 0 );
+		ajouter_transition( automate, 1, lettre, 1 );
+	}
+	ajouter_transition( automate, 0, 'x', 1 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 1 );
+	compile = compiler_automate( automate );
+	TEST( 
+		1
+		&& compile->nb_lettres == 26
+		&& compile->nb_classes == 2
+		&& compile->classe['a'] == compile->classe['z']
+		&& compile->classe['a'] != compile->classe['x']
+		&& compile->classe['A'] == -1
+		, result 
+	);
+	TEST( le_mot_est_reconnu_compile( compile, "abxz" ), result );
+	TEST( ! le_mot_est_reconnu_compile( compile, "abyz" ), result );
+	TEST( ! le_mot_est_reconnu_compile( compile, "abXz" ), result );
+	liberer_automate_compile( compile );
+
+	// Le déterminisé et l'automate minimal gardent toutes les lettres.
+	Automate * deterministe = creer_automate_deterministe( automate );
+	Automate * minimal = creer_automate_minimal( deterministe, NULL );
+	TEST( taille_ensemble( get_alphabet( minimal ) ) == 26, result );
+	TEST( taille_ensemble( get_etats( minimal ) ) == 2, result );
+	TEST( le_mot_est_reconnu( minimal, "abcx" ), result );
+	TEST( le_mot_est_reconnu( deterministe, "xq" ), result );
+	TEST( ! le_mot_est_reconnu( minimal, "abcq" ), result );
+	liberer_automate( minimal );
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+	liberer_ensemble( etats );
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_compiler_automate() ){ return 1; }
+	if( ! test_compiler_grand_automate() ){ return 1; }
+	if( ! test_compiler_masques() ){ return 1; }
+	if( ! test_reconnaitre_mots() ){ return 1; }
+	if( ! test_octets_et_classes() ){ return 1; }
+
+	return 0;
+}
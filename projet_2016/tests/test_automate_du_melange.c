@@ -21,6 +21,9 @@
 
 #include "automate.h"
 #include "outils.h"
+#include "ensemble.h"
+
+#include <string.h>
 
 void wrap_liberer_automate( Automate * aut ){
 	if( aut ){
@@ -130,6 +133,173 @@ int test_automate_du_melange(){
 		wrap_liberer_automate( mela );
 	}
 
+	{
+		// Des numéros d'états négatifs ou supérieurs à 65536 : l'ancien 
+		// codage (i << 16) + j confondait (1, 0) et (0, 65536).
+		Automate * aut1 = creer_automate();
+		ajouter_transition( aut1, 0, 'a', 1 );
+		ajouter_transition( aut1, 1, 'b', -7 );
+		ajouter_etat_initial( aut1, 0 );
+		ajouter_etat_final( aut1, -7 );
+
+		Automate * aut2 = creer_automate();
+		ajouter_transition( aut2, 0, 'c', 65536 );
+		ajouter_transition( aut2, 65536, 'd', 100000 );
+		ajouter_etat_initial( aut2, 0 );
+		ajouter_etat_final( aut2, 100000 );
+
+		Automate * mela = creer_automate_du_melange( aut1, aut2 );
+		TEST(
+			1
+			&& le_mot_est_reconnu( mela, "abcd" )
+			&& le_mot_est_reconnu( mela, "cadb" )
+			&& ! le_mot_est_reconnu( mela, "acbdd" )
+			&& ! le_mot_est_reconnu( mela, "acb" )
+			&& ! le_mot_est_reconnu( mela, "ca" )
+			, result
+		);
+		wrap_liberer_automate( aut1 );
+		wrap_liberer_automate( aut2 );
+		wrap_liberer_automate( mela );
+	}
+
+	{
+		// Seuls les couples accessibles sont construits : les 1000 états
+		// isolés de chaque automate ne donnent aucun état.
+		Automate * aut1 = mot_to_automate( "ab" );
+		Automate * aut2 = mot_to_automate( "c" );
+		for( int i = 0; i < 1000; i++ ){
+			ajouter_transition( aut1, 10 + i, 'a', 10 + i );
+			ajouter_transition( aut2, 10 + i, 'c', 10 + i );
+		}
+
+		Automate * mela = creer_automate_du_melange( aut1, aut2 );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( mela ) ) == 6
+			&& taille_ensemble( get_initiaux( mela ) ) == 1
+			&& taille_ensemble( get_finaux( mela ) ) == 1
+			&& taille_ensemble( get_alphabet( mela ) ) == 3
+			&& le_mot_est_reconnu( mela, "acb" )
+			&& ! le_mot_est_reconnu( mela, "ab" )
+			, result
+		);
+		wrap_liberer_automate( aut1 );
+		wrap_liberer_automate( aut2 );
+		wrap_liberer_automate( mela );
+	}
+
+	return result;
+}
+
+/*
+ * Compare le_mot_est_dans_le_melange() à la lecture sur l'automate du 
+ * mélange, pour tous les mots de longueur au plus 'longueur_max' sur 
+ * l'alphabet 'lettres'.
+ */
+static int comparer_au_melange(
+	const Automate * aut1, const Automate * aut2, 
+	const char * lettres, int longueur_max
+){
+	Automate * mela = creer_automate_du_melange( aut1, aut2 );
+	int nb_lettres = strlen( lettres );
+	int identiques = 1;
+	char mot[16];
+	int indices[16];
+	for( int longueur = 0; longueur <= longueur_max; longueur++ ){
+		for( int i = 0; i < longueur; i++ ){
+			indices[i] = 0;
+		}
+		for( ;; ){
+			for( int i = 0; i < longueur; i++ ){
+				mot[i] = lettres[ indices[i] ];
+			}
+			mot[ longueur ] = '\0';
+			identiques &= 
+				le_mot_est_dans_le_melange( aut1, aut2, mot ) 
+				== le_mot_est_reconnu( mela, mot );
+			int i = 0;
+			while( i < longueur && ++indices[i] == nb_lettres ){
+				indices[i++] = 0;
+			}
+			if( i == longueur ){
+				break;
+			}
+		}
+	}
+	liberer_automate( mela );
+	return identiques;
+}
+
+int test_le_mot_est_dans_le_melange(){
+
+	int result = 1;
+
+	{
+		Automate * aut1 = mot_to_automate("ab");
+		Automate * aut2 = mot_to_automate("cd");
+
+		TEST(
+			1
+			&& le_mot_est_dans_le_melange( aut1, aut2, "acbd" )
+			&& le_mot_est_dans_le_melange( aut1, aut2, "cdab" )
+			&& ! le_mot_est_dans_le_melange( aut1, aut2, "adcb" )
+			&& ! le_mot_est_dans_le_melange( aut1, aut2, "abc" )
+			&& ! le_mot_est_dans_le_melange( aut1, aut2, "abcdx" )
+			&& ! le_mot_est_dans_le_melange( aut1, aut2, "" )
+			, result
+		);
+		TEST( comparer_au_melange( aut1, aut2, "abcd", 5 ), result );
+		wrap_liberer_automate( aut1 );
+		wrap_liberer_automate( aut2 );
+	}
+
+	{
+		// Deux automates non déterministes, avec des lettres communes.
+		Automate * aut1 = creer_automate();
+		ajouter_transition( aut1, 0, 'a', 1 );
+		ajouter_transition( aut1, 0, 'a', 0 );
+		ajouter_transition( aut1, 1, 'b', 2 );
+		ajouter_transition( aut1, 2, 'a', 2 );
+		ajouter_transition( aut1, 2, 'b', 1 );
+		ajouter_etat_initial( aut1, 0 );
+		ajouter_etat_final( aut1, 1 );
+
+		Automate * aut2 = creer_automate();
+		ajouter_transition( aut2, 0, 'b', 1 );
+		ajouter_transition( aut2, 1, 'c', 1 );
+		ajouter_transition( aut2, 0, 'c', 0 );
+		ajouter_transition( aut2, 1, 'a', 0 );
+		ajouter_etat_initial( aut2, 0 );
+		ajouter_etat_initial( aut2, 1 );
+		ajouter_etat_final( aut2, 1 );
+
+		TEST( comparer_au_melange( aut1, aut2, "abc", 7 ), result );
+		wrap_liberer_automate( aut1 );
+		wrap_liberer_automate( aut2 );
+	}
+
+	{
+		// Un long mot : seule la frontière est gardée en mémoire.
+		Automate * aut1 = creer_automate();
+		ajouter_transition( aut1, 0, 'a', 0 );
+		ajouter_etat_initial( aut1, 0 );
+		ajouter_etat_final( aut1, 0 );
+		Automate * aut2 = mot_to_automate( "b" );
+
+		const int taille = 1000000;
+		char * mot = xmalloc( taille + 1 );
+		memset( mot, 'a', taille );
+		mot[ taille / 2 ] = 'b';
+		mot[ taille ] = '\0';
+		TEST( le_mot_est_dans_le_melange( aut1, aut2, mot ), result );
+		mot[ taille / 3 ] = 'b';
+		TEST( ! le_mot_est_dans_le_melange( aut1, aut2, mot ), result );
+		xfree( mot );
+		wrap_liberer_automate( aut1 );
+		wrap_liberer_automate( aut2 );
+	}
+
 	return result;
 }
 
@@ -137,6 +307,7 @@ int test_automate_du_melange(){
 int main(){
 
 	if( ! test_automate_du_melange() ){ return 1; }
+	if( ! test_le_mot_est_dans_le_melange() ){ return 1; }
 
 	return 0;
 }
@@ -0,0 +1,152 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+int test_coaccessibles(){
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate();
+
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 2, 'b', 3 );
+		ajouter_transition( automate, 2, 'a', 4 );
+		ajouter_transition( automate, 4, 'a', 4 );
+		ajouter_transition( automate, 5, 'b', 1 );
+		ajouter_etat_initial( automate, 1 );
+		ajouter_etat_final( automate, 3 );
+		ajouter_etat_final( automate, 6 );
+
+		Ensemble * ens = coaccessibles( automate );
+		TEST(
+			1
+			&& taille_ensemble( ens ) == 5
+			&& est_dans_l_ensemble( ens, 1 )
+			&& est_dans_l_ensemble( ens, 2 )
+			&& est_dans_l_ensemble( ens, 3 )
+			&& est_dans_l_ensemble( ens, 5 )
+			&& est_dans_l_ensemble( ens, 6 )
+			, result
+		);
+		liberer_ensemble( ens );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int test_automate_emonde(){
+	int result = 1;
+
+	{
+		// 4 n'est pas co-accessible, 5 n'est pas accessible.
+		Automate * automate = creer_automate();
+
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 2, 'b', 3 );
+		ajouter_transition( automate, 2, 'a', 4 );
+		ajouter_transition( automate, 4, 'a', 4 );
+		ajouter_transition( automate, 5, 'b', 1 );
+		ajouter_transition( automate, 3, 'c', 3 );
+		ajouter_etat_initial( automate, 1 );
+		ajouter_etat_final( automate, 3 );
+
+		Automate * aut = automate_emonde( automate );
+
+		TEST(
+			1
+			&& aut
+			&& taille_ensemble( get_etats( aut ) ) == 3
+			&& est_un_etat_de_l_automate( aut, 1 )
+			&& est_un_etat_de_l_automate( aut, 2 )
+			&& est_un_etat_de_l_automate( aut, 3 )
+			&& est_un_etat_initial_de_l_automate( aut, 1 )
+			&& est_un_etat_final_de_l_automate( aut, 3 )
+			&& taille_ensemble( get_alphabet( aut ) ) == 3
+			&& le_mot_est_reconnu( aut, "ab" )
+			&& le_mot_est_reconnu( aut, "abcc" )
+			&& ! le_mot_est_reconnu( aut, "aa" )
+			&& ! le_mot_est_reconnu( aut, "bab" )
+			, result
+		);
+		Ensemble * fins = delta1( aut, 2, 'a' );
+		TEST( taille_ensemble( fins ) == 0, result );
+		liberer_ensemble( fins );
+		liberer_automate( aut );
+		liberer_automate( automate );
+	}
+
+	{
+		// Sans état final, il ne reste rien.
+		Automate * automate = creer_automate();
+
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_etat_initial( automate, 1 );
+
+		Automate * aut = automate_emonde( automate );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( aut ) ) == 0
+			&& taille_ensemble( get_initiaux( aut ) ) == 0
+			&& ! le_mot_est_reconnu( aut, "a" )
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( automate );
+	}
+
+	{
+		// L'union de deux automates dont l'un ne reconnaît rien.
+		Automate * automate_1 = mot_to_automate( "abc" );
+		Automate * automate_2 = creer_automate();
+		ajouter_transition( automate_2, 0, 'a', 1 );
+		ajouter_transition( automate_2, 1, 'b', 1 );
+		ajouter_etat_initial( automate_2, 0 );
+
+		Automate * automate = creer_union_des_automates( automate_1, automate_2 );
+		Automate * aut = automate_emonde( automate );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( aut ) ) == 4
+			&& le_mot_est_reconnu( aut, "abc" )
+			&& ! le_mot_est_reconnu( aut, "ab" )
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( automate );
+		liberer_automate( automate_2 );
+		liberer_automate( automate_1 );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_coaccessibles() ){ return 1; };
+	if( ! test_automate_emonde() ){ return 1; };
+
+	return 0;
+	
+}
@@ -0,0 +1,159 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "automate_compile.h"
+#include "automate_paresseux.h"
+#include "outils.h"
+
+#include <string.h>
+
+int test_le_mot_est_reconnu_paresseux(){
+	int result = 1;
+
+	Automate* automate = creer_automate();
+	ajouter_transition( automate, 3, 'a', 5 );
+	ajouter_transition( automate, 5, 'b', 3 );
+	ajouter_transition( automate, 5, 'a', 5 );
+	ajouter_transition( automate, 5, 'a', -2 );
+	ajouter_transition( automate, 5, 'c', 600 );
+	ajouter_etat_initial( automate, 3 );
+	ajouter_etat_final( automate, 600 );
+
+	Automate_paresseux * paresseux = creer_automate_paresseux( automate, 0 );
+	liberer_automate( automate );
+
+	// Deux fois chaque mot : la seconde lecture passe par le cache.
+	for( int i = 0; i < 2; i++ ){
+		TEST( le_mot_est_reconnu_paresseux( paresseux, "ac" ), result );
+		TEST( le_mot_est_reconnu_paresseux( paresseux, "ababaac" ), result );
+		TEST( ! le_mot_est_reconnu_paresseux( paresseux, "" ), result );
+		TEST( ! le_mot_est_reconnu_paresseux( paresseux, "ab" ), result );
+		TEST( ! le_mot_est_reconnu_paresseux( paresseux, "acc" ), result );
+		TEST( ! le_mot_est_reconnu_paresseux( paresseux, "ax" ), result );
+	}
+	TEST( paresseux->nb_vidages == 0, result );
+	TEST( paresseux->nb_simulations == 0, result );
+	liberer_automate_paresseux( paresseux );
+
+	// Automate vide.
+	automate = creer_automate();
+	paresseux = creer_automate_paresseux( automate, 0 );
+	TEST( ! le_mot_est_reconnu_paresseux( paresseux, "" ), result );
+	TEST( ! le_mot_est_reconnu_paresseux( paresseux, "a" ), result );
+	liberer_automate_paresseux( paresseux );
+
+	// Le mot vide est reconnu.
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	paresseux = creer_automate_paresseux( automate, 0 );
+	TEST( le_mot_est_reconnu_paresseux( paresseux, "" ), result );
+	TEST( ! le_mot_est_reconnu_paresseux( paresseux, "a" ), result );
+	liberer_automate_paresseux( paresseux );
+	liberer_automate( automate );
+
+	return result;
+}
+
+/*
+ * Reconnaît les mots dont la n-ième lettre avant la fin est un 'a' : son 
+ * déterminisé a 2^n états.
+ */
+Automate * creer_automate_nieme_lettre( int n ){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( int i = 1; i < n; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, n );
+	return automate;
+}
+
+/*
+ * Compare le_mot_est_reconnu_paresseux() à le_mot_est_reconnu_compile() sur
+ * des mots pseudo-aléatoires.
+ */
+int comparer_lectures( 
+	const Automate_compile * compile, Automate_paresseux * paresseux,
+	int nb_mots, int longueur
+){
+	int result = 1;
+	char * mot = xmalloc( longueur + 1 );
+	unsigned int graine = 12345;
+	for( int i = 0; i < nb_mots; i++ ){
+		int taille = i % ( longueur + 1 );
+		for( int j = 0; j < taille; j++ ){
+			graine = graine * 1103515245u + 12345u;
+			mot[j] = "ab"[ ( graine >> 16 ) & 1 ];
+		}
+		mot[taille] = '\0';
+		int attendu = le_mot_est_reconnu_compile( compile, mot );
+		int obtenu = le_mot_est_reconnu_paresseux( paresseux, mot );
+		TEST( attendu == obtenu, result );
+	}
+	xfree( mot );
+	return result;
+}
+
+int test_cache_borne(){
+	int result = 1;
+
+	Automate * automate = creer_automate_nieme_lettre( 10 );
+	Automate_compile * compile = compiler_automate( automate );
+
+	// Le cache suffit : il n'est jamais vidé.
+	Automate_paresseux * paresseux = creer_automate_paresseux( automate, 0 );
+	TEST( comparer_lectures( compile, paresseux, 200, 300 ), result );
+	TEST( paresseux->nb_vidages == 0, result );
+	TEST( paresseux->nb_simulations == 0, result );
+	liberer_automate_paresseux( paresseux );
+
+	// Le cache ne contient qu'une partie des 1024 états du déterminisé : il
+	// est vidé, mais reste assez utile pour ne pas être abandonné.
+	paresseux = creer_automate_paresseux( automate, 16 << 10 );
+	TEST( comparer_lectures( compile, paresseux, 200, 3000 ), result );
+	TEST( paresseux->nb_vidages > 0, result );
+	liberer_automate_paresseux( paresseux );
+
+	// Le cache est trop petit : les mots sont finis par simulation.
+	paresseux = creer_automate_paresseux( automate, 1 );
+	TEST( comparer_lectures( compile, paresseux, 200, 300 ), result );
+	TEST( paresseux->nb_vidages > 0, result );
+	TEST( paresseux->nb_simulations > 0, result );
+	liberer_automate_paresseux( paresseux );
+
+	liberer_automate_compile( compile );
+	liberer_automate( automate );
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_le_mot_est_reconnu_paresseux() ){ return 1; }
+	if( ! test_cache_borne() ){ return 1; }
+
+	return 0;
+}
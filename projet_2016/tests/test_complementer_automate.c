@@ -0,0 +1,133 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+int test_complementer_automate(){
+	int result = 1;
+
+	{
+		// Les mots sur {a, b} qui contiennent "ab" : non déterministe.
+		Automate * automate = creer_automate();
+
+		ajouter_transition( automate, 0, 'a', 0 );
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'b', 2 );
+		ajouter_transition( automate, 2, 'a', 2 );
+		ajouter_transition( automate, 2, 'b', 2 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+
+		Automate * aut = complementer_automate( automate );
+
+		TEST(
+			1
+			&& est_deterministe( aut )
+			&& le_mot_est_reconnu( aut, "" )
+			&& le_mot_est_reconnu( aut, "bbaa" )
+			&& le_mot_est_reconnu( aut, "a" )
+			&& ! le_mot_est_reconnu( aut, "ab" )
+			&& ! le_mot_est_reconnu( aut, "bbabaa" )
+			&& ! le_mot_est_reconnu( aut, "c" )
+			, result
+		);
+
+		// Le complémentaire du complémentaire.
+		Automate * aut2 = complementer_automate( aut );
+		TEST(
+			1
+			&& le_mot_est_reconnu( aut2, "bbabaa" )
+			&& ! le_mot_est_reconnu( aut2, "bbaa" )
+			, result
+		);
+		liberer_automate( aut2 );
+		liberer_automate( aut );
+		liberer_automate( automate );
+	}
+
+	{
+		// Le complémentaire du langage vide.
+		Automate * automate = creer_automate();
+
+		ajouter_lettre( automate, 'a' );
+		ajouter_lettre( automate, 'b' );
+
+		Automate * aut = complementer_automate( automate );
+		TEST(
+			1
+			&& le_mot_est_reconnu( aut, "" )
+			&& le_mot_est_reconnu( aut, "abba" )
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( automate );
+	}
+
+	{
+		// Différence : les mots de (a|b)*b qui ne contiennent pas "aa".
+		Automate * automate_1 = creer_automate();
+		ajouter_transition( automate_1, 0, 'a', 0 );
+		ajouter_transition( automate_1, 0, 'b', 0 );
+		ajouter_transition( automate_1, 0, 'b', 1 );
+		ajouter_etat_initial( automate_1, 0 );
+		ajouter_etat_final( automate_1, 1 );
+
+		Automate * automate_2 = creer_automate();
+		ajouter_transition( automate_2, 0, 'a', 0 );
+		ajouter_transition( automate_2, 0, 'b', 0 );
+		ajouter_transition( automate_2, 0, 'a', 1 );
+		ajouter_transition( automate_2, 1, 'a', 2 );
+		ajouter_transition( automate_2, 2, 'a', 2 );
+		ajouter_transition( automate_2, 2, 'b', 2 );
+		ajouter_etat_initial( automate_2, 0 );
+		ajouter_etat_final( automate_2, 2 );
+
+		Automate * complement = complementer_automate( automate_2 );
+		Automate * difference = creer_intersection_des_automates( 
+			automate_1, complement 
+		);
+		TEST(
+			1
+			&& le_mot_est_reconnu( difference, "b" )
+			&& le_mot_est_reconnu( difference, "abab" )
+			&& ! le_mot_est_reconnu( difference, "aab" )
+			&& ! le_mot_est_reconnu( difference, "ba" )
+			, result
+		);
+		liberer_automate( difference );
+		liberer_automate( complement );
+		liberer_automate( automate_2 );
+		liberer_automate( automate_1 );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_complementer_automate() ){ return 1; };
+
+	return 0;
+	
+}
@@ -0,0 +1,103 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+int test_completer_automate(){
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate();
+
+		ajouter_transition( automate, 10, 'a', 20 );
+		ajouter_transition( automate, 20, 'b', 20 );
+		ajouter_transition( automate, 20, 'b', 10 );
+		ajouter_etat_initial( automate, 10 );
+		ajouter_etat_final( automate, 20 );
+
+		Automate * aut = completer_automate( automate );
+
+		TEST(
+			1
+			&& taille_ensemble( get_etats( aut ) ) == 3
+			&& est_un_etat_initial_de_l_automate( aut, 0 )
+			&& est_un_etat_final_de_l_automate( aut, 1 )
+			&& ! est_un_etat_final_de_l_automate( aut, 2 )
+			&& est_une_transition_de_l_automate( aut, 0, 'a', 1 )
+			&& est_une_transition_de_l_automate( aut, 0, 'b', 2 )
+			&& est_une_transition_de_l_automate( aut, 1, 'a', 2 )
+			&& est_une_transition_de_l_automate( aut, 1, 'b', 0 )
+			&& est_une_transition_de_l_automate( aut, 2, 'a', 2 )
+			&& est_une_transition_de_l_automate( aut, 2, 'b', 2 )
+			&& le_mot_est_reconnu( aut, "ab" )
+			&& le_mot_est_reconnu( aut, "abbab" )
+			&& ! le_mot_est_reconnu( aut, "b" )
+			&& ! le_mot_est_reconnu( aut, "aa" )
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( automate );
+	}
+
+	{
+		// Un automate déjà complet ne reçoit pas de puits.
+		Automate * automate = creer_automate();
+
+		ajouter_transition( automate, 5, 'a', 5 );
+		ajouter_etat_initial( automate, 5 );
+
+		Automate * aut = completer_automate( automate );
+		TEST( taille_ensemble( get_etats( aut ) ) == 1, result );
+		liberer_automate( aut );
+		liberer_automate( automate );
+	}
+
+	{
+		// Sans état initial, le puits devient initial.
+		Automate * automate = creer_automate();
+
+		ajouter_lettre( automate, 'a' );
+
+		Automate * aut = completer_automate( automate );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( aut ) ) == 1
+			&& est_un_etat_initial_de_l_automate( aut, 0 )
+			&& est_une_transition_de_l_automate( aut, 0, 'a', 0 )
+			&& ! le_mot_est_reconnu( aut, "" )
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_completer_automate() ){ return 1; };
+
+	return 0;
+	
+}
@@ -0,0 +1,138 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "automate.h"
+#include "outils.h"
+
+void remplir_automate( Automate * automate ){
+	ajouter_transition( automate, 1, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'a', 3 );
+	ajouter_transition( automate, 2, 'a', 1 );
+	ajouter_etat_initial( automate, 1 );
+	ajouter_etat_final( automate, 3 );
+}
+
+int test_creer_automate_arena(){
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate_arena();
+		remplir_automate( automate );
+
+		TEST(
+			1
+			&& automate
+			&& est_un_etat_de_l_automate( automate, 3 )
+			&& est_une_transition_de_l_automate( automate, 2, 'a', 3 )
+			&& est_une_transition_de_l_automate( automate, 2, 'a', 1 )
+			&& ! est_une_transition_de_l_automate( automate, 2, 'b', 1 )
+			&& le_mot_est_reconnu( automate, "aaba" )
+			&& le_mot_est_reconnu( automate, "abaaba" )
+			&& ! le_mot_est_reconnu( automate, "ab" )
+			, result
+		);
+
+		Automate * copie = copier_automate( automate );
+		Automate * aut_miroir = miroir( automate );
+		TEST(
+			1
+			&& le_mot_est_reconnu( copie, "aaba" )
+			&& le_mot_est_reconnu( aut_miroir, "abaa" )
+			&& ! le_mot_est_reconnu( aut_miroir, "aaba" )
+			, result
+		);
+		liberer_automate( copie );
+		liberer_automate( aut_miroir );
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int test_vider_automate(){
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate_arena();
+		Automate * automate_tas = creer_automate();
+		int i;
+		for( i=0; i<3; i++ ){
+			remplir_automate( automate );
+			remplir_automate( automate_tas );
+			TEST(
+				1
+				&& le_mot_est_reconnu( automate, "ba" )
+				&& le_mot_est_reconnu( automate_tas, "ba" )
+				, result
+			);
+			vider_automate( automate );
+			vider_automate( automate_tas );
+			TEST(
+				1
+				&& ! le_mot_est_reconnu( automate, "ba" )
+				&& ! le_mot_est_reconnu( automate_tas, "ba" )
+				&& taille_ensemble( get_etats( automate ) ) == 0
+				&& taille_ensemble( get_alphabet( automate_tas ) ) == 0
+				, result
+			);
+		}
+		liberer_automate( automate );
+		liberer_automate( automate_tas );
+	}
+
+	return result;
+}
+
+int test_union_automate_arena(){
+	int result = 1;
+
+	{
+		Automate * aut1 = creer_automate_arena();
+		Automate * aut2 = mot_to_automate( "ab" );
+		remplir_automate( aut1 );
+
+		Automate * aut = creer_union_des_automates( aut1, aut2 );
+		TEST(
+			1
+			&& aut
+			&& le_mot_est_reconnu( aut, "ab" )
+			&& le_mot_est_reconnu( aut, "ba" )
+			&& ! le_mot_est_reconnu( aut, "a" )
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( aut1 );
+		liberer_automate( aut2 );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_creer_automate_arena() ){ return 1; };
+	if( ! test_vider_automate() ){ return 1; };
+	if( ! test_union_automate_arena() ){ return 1; };
+
+	return 0;
+	
+}
@@ -90,13 +90,121 @@ int test_transitions_automate( int nb_transitions, const Automate* aut, ... ){
 int test_creer_automate_deterministe(){
 	int resultat = 1;
 	{
+		// Les mots qui finissent par "ab".
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 0 );
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'b', 2 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+
+		Automate * deterministe = creer_automate_deterministe( automate );
+
+		// {0} -> 0, {0,1} -> 1, {0,2} -> 2
+		TEST(
+			1
+			&& deterministe
+			&& l_ensemble_est_egal( 3, get_etats( deterministe ), 0, 1, 2 )
+			&& l_ensemble_est_egal( 1, get_initiaux( deterministe ), 0 )
+			&& l_ensemble_est_egal( 1, get_finaux( deterministe ), 2 )
+			&& l_ensemble_est_egal( 2, get_alphabet( deterministe ), 'a', 'b' )
+			&& test_transitions_automate(
+				6, deterministe,
+				0, 'a', 1,
+				0, 'b', 0,
+				1, 'a', 1,
+				1, 'b', 2,
+				2, 'a', 1,
+				2, 'b', 0
+			)
+			, resultat
+		);
 
+		liberer_automate( deterministe );
+		liberer_automate( automate );
+	}
+	{
+		// Les états ne sont pas consécutifs, l'ensemble vide n'est pas un 
+		// état et les états inaccessibles disparaissent.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 10, 'a', 30 );
+		ajouter_transition( automate, 10, 'a', -4 );
+		ajouter_transition( automate, 20, 'a', 10 );
+		ajouter_transition( automate, -4, 'b', 30 );
+		ajouter_transition( automate, 30, 'b', 30 );
+		ajouter_lettre( automate, 'c' );
+		ajouter_etat_initial( automate, 10 );
+		ajouter_etat_final( automate, 30 );
+
+		Automate * deterministe = creer_automate_deterministe( automate );
+
+		// {10} -> 0, {-4,30} -> 1, {30} -> 2
 		TEST(
-			0
-			,resultat
-		);	
-		// N'oubliez pas de tester votre code !
+			1
+			&& l_ensemble_est_egal( 3, get_etats( deterministe ), 0, 1, 2 )
+			&& l_ensemble_est_egal( 1, get_initiaux( deterministe ), 0 )
+			&& l_ensemble_est_egal( 2, get_finaux( deterministe ), 1, 2 )
+			&& l_ensemble_est_egal( 3, get_alphabet( deterministe ), 'a', 'b', 'c' )
+			&& test_transitions_automate(
+				3, deterministe,
+				0, 'a', 1,
+				1, 'b', 2,
+				2, 'b', 2
+			)
+			, resultat
+		);
+
+		liberer_automate( deterministe );
+		liberer_automate( automate );
+	}
+	{
+		// Le n-ième avant-dernier caractère est un a : 2^(n+1) états.
+		int n = 9;
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 0 );
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		for( int i=1; i<=n; i++ ){
+			ajouter_transition( automate, i, 'a', i+1 );
+			ajouter_transition( automate, i, 'b', i+1 );
+		}
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, n+1 );
+
+		Automate * deterministe = creer_automate_deterministe( automate );
 
+		TEST(
+			taille_ensemble( get_etats( deterministe ) ) == 1 << ( n+1 ),
+			resultat
+		);
+		const char * mots[] = {
+			"", "a", "aaaaaaaaaa", "abbbbbbbbb", "bbbbbbbbbb", 
+			"babbbbbbbbb", "bbabbbbbbbb", "ababababababa"
+		};
+		for( int i=0; i<8; i++ ){
+			TEST(
+				le_mot_est_reconnu( automate, mots[i] ) ==
+				le_mot_est_reconnu( deterministe, mots[i] )
+				, resultat
+			);
+		}
+
+		liberer_automate( deterministe );
+		liberer_automate( automate );
+	}
+	{
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 1 );
+		Automate * deterministe = creer_automate_deterministe( automate );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( deterministe ) ) == 0
+			&& l_ensemble_est_egal( 1, get_alphabet( deterministe ), 'a' )
+			, resultat
+		);
+		liberer_automate( deterministe );
+		liberer_automate( automate );
 	}
 
 	return resultat;
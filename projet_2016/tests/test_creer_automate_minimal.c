@@ -0,0 +1,195 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+
+int nb_etats( const Automate * automate ){
+	return taille_ensemble( get_etats( automate ) );
+}
+
+int memes_mots(
+	const Automate * automate1, const Automate * automate2, 
+	int nb_mots, const char ** mots
+){
+	for( int i=0; i<nb_mots; i++ ){
+		if( 
+			le_mot_est_reconnu( automate1, mots[i] ) != 
+			le_mot_est_reconnu( automate2, mots[i] ) 
+		){
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int test_est_deterministe(){
+	int result = 1;
+
+	Automate * automate = creer_automate();
+	TEST( est_deterministe( automate ), result );
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 0, 'b', 1 );
+	ajouter_etat_initial( automate, 0 );
+	TEST( est_deterministe( automate ), result );
+	ajouter_transition( automate, 0, 'a', 2 );
+	TEST( ! est_deterministe( automate ), result );
+	liberer_automate( automate );
+
+	automate = creer_automate();
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_initial( automate, 1 );
+	TEST( ! est_deterministe( automate ), result );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int test_creer_automate_minimal(){
+	int result = 1;
+
+	// Les mots sur {a,b} qui contiennent un nombre pair de a : 1 et 3 sont 
+	// équivalents à 0, 2 à 4. 5 est inaccessible, 6 ne mène à aucun état 
+	// final.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 2 );
+	ajouter_transition( automate, 0, 'b', 1 );
+	ajouter_transition( automate, 1, 'a', 4 );
+	ajouter_transition( automate, 1, 'b', 3 );
+	ajouter_transition( automate, 3, 'a', 2 );
+	ajouter_transition( automate, 3, 'b', 0 );
+	ajouter_transition( automate, 2, 'a', 3 );
+	ajouter_transition( automate, 2, 'b', 4 );
+	ajouter_transition( automate, 4, 'a', 1 );
+	ajouter_transition( automate, 4, 'b', 2 );
+	ajouter_transition( automate, 4, 'c', 6 );
+	ajouter_transition( automate, 6, 'a', 6 );
+	ajouter_transition( automate, 5, 'a', 0 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	ajouter_etat_final( automate, 1 );
+	ajouter_etat_final( automate, 3 );
+	ajouter_etat_final( automate, 5 );
+
+	Table * correspondance = creer_table( NULL, NULL, NULL );
+	Automate * minimal = creer_automate_minimal( automate, correspondance );
+
+	TEST( nb_etats( minimal ) == 2, result );
+	TEST( est_deterministe( minimal ), result );
+	TEST( est_un_etat_initial_de_l_automate( minimal, 0 ), result );
+	TEST( est_un_etat_final_de_l_automate( minimal, 0 ), result );
+	TEST( ! est_un_etat_final_de_l_automate( minimal, 1 ), result );
+	TEST( est_une_transition_de_l_automate( minimal, 0, 'a', 1 ), result );
+	TEST( est_une_transition_de_l_automate( minimal, 0, 'b', 0 ), result );
+	TEST( est_une_transition_de_l_automate( minimal, 1, 'a', 0 ), result );
+	TEST( est_une_transition_de_l_automate( minimal, 1, 'b', 1 ), result );
+	TEST( est_une_lettre_de_l_automate( minimal, 'c' ), result );
+
+	intptr_t nouveau;
+	TEST( taille_table( correspondance ) == 5, result );
+	TEST( trouver_valeur_table( correspondance, 3, &nouveau ) && nouveau == 0, result );
+	TEST( trouver_valeur_table( correspondance, 4, &nouveau ) && nouveau == 1, result );
+	TEST( ! trouver_valeur_table( correspondance, 5, NULL ), result );
+	TEST( ! trouver_valeur_table( correspondance, 6, NULL ), result );
+
+	const char * mots[] = { "", "a", "aa", "ab", "aba", "bbab", "abc", "ac" };
+	TEST( memes_mots( automate, minimal, 8, mots ), result );
+
+	liberer_table( correspondance );
+	liberer_automate( minimal );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int test_minimiser_deterministe(){
+	int result = 1;
+
+	// {ab, cb} : après déterminisation, les états atteints par a et par c 
+	// sont équivalents.
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 0, 'c', 3 );
+	ajouter_transition( automate, 3, 'b', 4 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+	ajouter_etat_final( automate, 4 );
+	Automate * minimal = creer_automate_minimal( automate, NULL );
+	TEST( nb_etats( minimal ) == 3, result );
+	const char * mots[] = { "", "a", "ab", "cb", "bb", "abb", "c" };
+	TEST( memes_mots( automate, minimal, 7, mots ), result );
+	liberer_automate( minimal );
+	liberer_automate( automate );
+
+	// L'automate déterminisé du n-ième caractère avant la fin est déjà 
+	// minimal.
+	int n = 6;
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', 1 );
+	for( int i=1; i<=n; i++ ){
+		ajouter_transition( automate, i, 'a', i+1 );
+		ajouter_transition( automate, i, 'b', i+1 );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, n+1 );
+	Automate * deterministe = creer_automate_deterministe( automate );
+	minimal = creer_automate_minimal( deterministe, NULL );
+	TEST( nb_etats( minimal ) == 1 << ( n+1 ), result );
+	liberer_automate( minimal );
+	liberer_automate( deterministe );
+	liberer_automate( automate );
+
+	// Un mot : déjà minimal.
+	automate = mot_to_automate( "abcab" );
+	minimal = creer_automate_minimal( automate, NULL );
+	TEST( nb_etats( minimal ) == 6, result );
+	TEST( le_mot_est_reconnu( minimal, "abcab" ), result );
+	liberer_automate( minimal );
+	liberer_automate( automate );
+
+	// Langage vide : aucun état.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_etat_initial( automate, 0 );
+	minimal = creer_automate_minimal( automate, NULL );
+	TEST( nb_etats( minimal ) == 0, result );
+	liberer_automate( minimal );
+	liberer_automate( automate );
+
+	return result;
+}
+
+int main(){
+	int result = 1;
+
+	result &= test_est_deterministe();
+	result &= test_creer_automate_minimal();
+	result &= test_minimiser_deterministe();
+
+	if( ! result ){
+		fprintf( stderr, "Certains tests du fichier %s ont échoués.\n", __FILE__ );
+		return 1;
+	}
+
+	return 0;
+}
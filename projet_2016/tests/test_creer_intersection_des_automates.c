@@ -0,0 +1,94 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+#include "ensemble.h"
+
+int test_creer_intersection_des_automates(){
+	int result = 1;
+
+	{
+		// Un nombre pair de a, et un b en dernière position.
+		Automate * automate_1 = creer_automate();
+		ajouter_transition( automate_1, 0, 'a', 1 );
+		ajouter_transition( automate_1, 1, 'a', 0 );
+		ajouter_transition( automate_1, 0, 'b', 0 );
+		ajouter_transition( automate_1, 1, 'b', 1 );
+		ajouter_etat_initial( automate_1, 0 );
+		ajouter_etat_final( automate_1, 0 );
+
+		Automate * automate_2 = creer_automate();
+		ajouter_transition( automate_2, -3, 'a', -3 );
+		ajouter_transition( automate_2, -3, 'b', -3 );
+		ajouter_transition( automate_2, -3, 'b', 70000 );
+		ajouter_transition( automate_2, 70000, 'c', 70000 );
+		ajouter_etat_initial( automate_2, -3 );
+		ajouter_etat_final( automate_2, 70000 );
+
+		Automate * aut = creer_intersection_des_automates( automate_1, automate_2 );
+
+		TEST(
+			1
+			&& taille_ensemble( get_etats( aut ) ) == 4
+			&& est_un_etat_initial_de_l_automate( aut, 0 )
+			&& taille_ensemble( get_alphabet( aut ) ) == 2
+			&& le_mot_est_reconnu( aut, "b" )
+			&& le_mot_est_reconnu( aut, "aab" )
+			&& le_mot_est_reconnu( aut, "abab" )
+			&& ! le_mot_est_reconnu( aut, "ab" )
+			&& ! le_mot_est_reconnu( aut, "aa" )
+			&& ! le_mot_est_reconnu( aut, "bc" )
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( automate_2 );
+		liberer_automate( automate_1 );
+	}
+
+	{
+		// Langages disjoints : aucun couple final n'est accessible.
+		Automate * automate_1 = mot_to_automate( "ab" );
+		Automate * automate_2 = mot_to_automate( "ac" );
+
+		Automate * aut = creer_intersection_des_automates( automate_1, automate_2 );
+		TEST(
+			1
+			&& taille_ensemble( get_etats( aut ) ) == 2
+			&& taille_ensemble( get_finaux( aut ) ) == 0
+			&& ! le_mot_est_reconnu( aut, "ab" )
+			, result
+		);
+		liberer_automate( aut );
+		liberer_automate( automate_2 );
+		liberer_automate( automate_1 );
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_creer_intersection_des_automates() ){ return 1; };
+
+	return 0;
+	
+}
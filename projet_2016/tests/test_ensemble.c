@@ -937,6 +937,163 @@ int test_get_element(){
 	return result;
 }
 
+int test_ensemble_bitset(){
+	int result = 1;
+
+	// ens1 et ens2 restent représentés par des bits.
+	Ensemble * ens1 = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * ens2 = creer_ensemble( NULL, NULL, NULL );
+	// avl contient les mêmes éléments que ens2, mais dans un arbre.
+	Ensemble * avl = creer_ensemble( NULL, NULL, NULL );
+	ajouter_element( avl, -1 );
+	retirer_element( avl, -1 );
+
+	for( int i=0; i<200; i+=3 ){
+		ajouter_element( ens1, i );
+	}
+	for( int i=0; i<300; i+=5 ){
+		ajouter_element( ens2, i );
+		ajouter_element( avl, i );
+	}
+	TEST( ens1->table == NULL, result );
+	TEST( ens2->table == NULL, result );
+	TEST( avl->table != NULL, result );
+	TEST( taille_ensemble( ens1 ) == 67, result );
+	TEST( taille_ensemble( ens2 ) == 60, result );
+	TEST( comparer_ensemble( ens2, avl ) == 0, result );
+	TEST( comparer_ensemble( ens1, ens2 ) == -1, result );
+	TEST( comparer_ensemble( ens2, ens1 ) == 1, result );
+
+	Ensemble * u = creer_union_ensemble( ens1, ens2 );
+	Ensemble * u_avl = creer_union_ensemble( ens1, avl );
+	Ensemble * n = creer_intersection_ensemble( ens1, ens2 );
+	Ensemble * n_avl = creer_intersection_ensemble( avl, ens1 );
+	Ensemble * d = creer_difference_ensemble( ens1, ens2 );
+	Ensemble * d_avl = creer_difference_ensemble( ens1, avl );
+
+	TEST( u->table == NULL, result );
+	TEST( n->table == NULL, result );
+	TEST( d->table == NULL, result );
+	TEST( comparer_ensemble( u, u_avl ) == 0, result );
+	TEST( comparer_ensemble( n, n_avl ) == 0, result );
+	TEST( comparer_ensemble( d, d_avl ) == 0, result );
+	TEST( taille_ensemble( u ) == 67 + 60 - 14, result );
+	TEST( taille_ensemble( n ) == 14, result );
+	TEST( taille_ensemble( d ) == 67 - 14, result );
+	TEST( est_dans_l_ensemble( u, 295 ), result );
+	TEST( est_dans_l_ensemble( n, 195 ), result );
+	TEST( ! est_dans_l_ensemble( d, 195 ), result );
+	TEST( ! est_dans_l_ensemble( d, 10000 ), result );
+
+	Ensemble_iterateur it = trouver_ensemble( n, 45 );
+	TEST( get_element( it ) == 45, result );
+	it = iterateur_suivant_ensemble( it );
+	TEST( get_element( it ) == 60, result );
+	it = iterateur_precedent_ensemble( it );
+	it = iterateur_precedent_ensemble( it );
+	TEST( get_element( it ) == 30, result );
+	TEST( iterateur_ensemble_est_vide( trouver_ensemble( n, 46 ) ), result );
+
+	// Un élément trop grand fait basculer l'ensemble sur un arbre.
+	ajouter_element( d, 1000000 );
+	TEST( d->table != NULL, result );
+	TEST( taille_ensemble( d ) == 67 - 14 + 1, result );
+	TEST( est_dans_l_ensemble( d, 1000000 ), result );
+	TEST( est_dans_l_ensemble( d, 198 ), result );
+	vider_ensemble( d );
+	TEST( d->table == NULL, result );
+	TEST( taille_ensemble( d ) == 0, result );
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+	liberer_ensemble( avl );
+	liberer_ensemble( u );
+	liberer_ensemble( u_avl );
+	liberer_ensemble( n );
+	liberer_ensemble( n_avl );
+	liberer_ensemble( d );
+	liberer_ensemble( d_avl );
+
+	return result;
+}
+
+int test_union_intersection_dans(){
+	int result = 1;
+
+	// Ensembles d'entiers représentés par des arbres (éléments négatifs).
+	Ensemble * ens1 = creer_ensemble( NULL, NULL, NULL );
+	Ensemble * ens2 = creer_ensemble( NULL, NULL, NULL );
+	for( int i=0; i<1000; i++ ){
+		ajouter_element( ens1, -2*i );
+		ajouter_element( ens2, -3*i );
+	}
+	Ensemble * u = creer_union_ensemble( ens1, ens2 );
+	Ensemble * n = creer_intersection_ensemble( ens1, ens2 );
+	Ensemble * d = creer_difference_ensemble( ens1, ens2 );
+	TEST( taille_ensemble( u ) == 1666, result );
+	TEST( taille_ensemble( n ) == 334, result );
+	TEST( taille_ensemble( d ) == 666, result );
+	TEST( est_dans_l_ensemble( u, -2997 ), result );
+	TEST( est_dans_l_ensemble( n, -6 ), result );
+	TEST( ! est_dans_l_ensemble( d, -6 ), result );
+
+	Ensemble * copie = copier_ensemble( ens1 );
+	union_dans( copie, ens2 );
+	TEST( comparer_ensemble( copie, u ) == 0, result );
+	intersection_dans( copie, ens1 );
+	TEST( comparer_ensemble( copie, ens1 ) == 0, result );
+	intersection_dans( copie, ens2 );
+	TEST( comparer_ensemble( copie, n ) == 0, result );
+	// Petit ensemble : intersection élément par élément.
+	ajouter_element( d, -3 );
+	intersection_dans( d, u );
+	TEST( taille_ensemble( d ) == 667, result );
+	intersection_dans( d, n );
+	TEST( taille_ensemble( d ) == 0, result );
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+	liberer_ensemble( u );
+	liberer_ensemble( n );
+	liberer_ensemble( d );
+	liberer_ensemble( copie );
+
+	// Ensembles dont les éléments sont copiés et supprimés par l'ensemble.
+	ens1 = creer_ensemble(
+		(int (*)( const intptr_t, const intptr_t)) comparer_elmt, 
+		(intptr_t (*)( const intptr_t )) copier_elmt, 
+		(void (*)( intptr_t )) supprimer_elmt
+	);
+	ens2 = creer_ensemble(
+		(int (*)( const intptr_t, const intptr_t)) comparer_elmt, 
+		(intptr_t (*)( const intptr_t )) copier_elmt, 
+		(void (*)( intptr_t )) supprimer_elmt
+	);
+	Elmt elmt;
+	for( int i=0; i<100; i++ ){
+		initialiser_elmt( &elmt, i );
+		ajouter_element( ens1, (intptr_t) &elmt );
+		initialiser_elmt( &elmt, i+50 );
+		ajouter_element( ens2, (intptr_t) &elmt );
+	}
+	n = creer_intersection_ensemble( ens1, ens2 );
+	TEST( taille_ensemble( n ) == 50, result );
+	union_dans( ens1, ens2 );
+	TEST( taille_ensemble( ens1 ) == 150, result );
+	initialiser_elmt( &elmt, 149 );
+	TEST( est_dans_l_ensemble( ens1, (intptr_t) &elmt ), result );
+	intersection_dans( ens1, n );
+	TEST( comparer_ensemble( ens1, n ) == 0, result );
+	initialiser_elmt( &elmt, 50 );
+	TEST( ((Elmt*) get_element( premier_iterateur_ensemble( ens1 ) ))->elmt == 50, result );
+
+	liberer_ensemble( ens1 );
+	liberer_ensemble( ens2 );
+	liberer_ensemble( n );
+
+	return result;
+}
+
 
 int main(){
 	int result = 1;
@@ -962,6 +1119,8 @@ int main(){
 	result &= test_iterateur_precedent_ensemble();
 	result &= test_iterateur_ensemble_est_vide();
 	result &= test_get_element();
+	result &= test_ensemble_bitset();
+	result &= test_union_intersection_dans();
 
 	if( ! result ){
 		fprintf( stderr, "Certains tests du fichier %s ont échoués.\n", __FILE__ );
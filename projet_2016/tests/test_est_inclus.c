@@ -0,0 +1,208 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "inclusion.h"
+#include "outils.h"
+
+#include <string.h>
+
+int test_est_inclus(){
+	int result = 1;
+
+	{
+		// ab est dans (a|b)*, reconnu par un automate non déterministe.
+		Automate * automate_a = mot_to_automate( "ab" );
+		Automate * automate_b = creer_automate();
+		ajouter_transition( automate_b, 0, 'a', 0 );
+		ajouter_transition( automate_b, 0, 'b', 0 );
+		ajouter_transition( automate_b, 0, 'a', 1 );
+		ajouter_transition( automate_b, 1, 'b', 2 );
+		ajouter_etat_initial( automate_b, 0 );
+		ajouter_etat_final( automate_b, 0 );
+		ajouter_etat_final( automate_b, 2 );
+
+		char * contre_exemple = (char *) "x";
+		int inclus = est_inclus( automate_a, automate_b, &contre_exemple );
+		TEST( inclus && contre_exemple == NULL, result );
+
+		inclus = est_inclus( automate_b, automate_a, &contre_exemple );
+		TEST( 
+			! inclus && contre_exemple && strcmp( contre_exemple, "" ) == 0,
+			result
+		);
+		xfree( contre_exemple );
+
+		liberer_automate( automate_b );
+		liberer_automate( automate_a );
+	}
+
+	{
+		// a*b n'est pas inclus dans ab : le plus court contre-exemple est b.
+		Automate * automate_a = creer_automate();
+		ajouter_transition( automate_a, 0, 'a', 0 );
+		ajouter_transition( automate_a, 0, 'b', 1 );
+		ajouter_etat_initial( automate_a, 0 );
+		ajouter_etat_final( automate_a, 1 );
+		Automate * automate_b = mot_to_automate( "ab" );
+
+		char * contre_exemple = NULL;
+		int inclus = est_inclus( automate_a, automate_b, &contre_exemple );
+		TEST(
+			! inclus && contre_exemple && strcmp( contre_exemple, "b" ) == 0,
+			result
+		);
+		xfree( contre_exemple );
+
+		inclus = est_inclus( automate_b, automate_a, NULL );
+		TEST( inclus, result );
+
+		liberer_automate( automate_b );
+		liberer_automate( automate_a );
+	}
+
+	{
+		// Un automate sans état initial est inclus dans tout automate.
+		Automate * automate_a = creer_automate();
+		ajouter_transition( automate_a, 0, 'a', 1 );
+		ajouter_etat_final( automate_a, 1 );
+		Automate * automate_b = creer_automate();
+
+		char * contre_exemple = NULL;
+		int inclus = est_inclus( automate_a, automate_b, &contre_exemple );
+		TEST( inclus && contre_exemple == NULL, result );
+
+		liberer_automate( automate_b );
+		liberer_automate( automate_a );
+	}
+
+	{
+		// B a plus de 64 états : les ensembles tiennent sur plusieurs mots.
+		Automate * automate_b = creer_automate();
+		for( int i = 0; i < 100; i++ ){
+			ajouter_transition( automate_b, i, 'a', i+1 );
+			ajouter_etat_final( automate_b, i+1 );
+		}
+		ajouter_etat_initial( automate_b, 0 );
+
+		char mot[102];
+		memset( mot, 'a', 101 );
+		mot[101] = '\0';
+		Automate * automate_a = creer_automate();
+		for( int i = 0; i < 101; i++ ){
+			ajouter_transition( automate_a, i, 'a', i+1 );
+			ajouter_etat_final( automate_a, i+1 );
+		}
+		ajouter_etat_initial( automate_a, 0 );
+
+		char * contre_exemple = NULL;
+		int inclus = est_inclus( automate_a, automate_b, &contre_exemple );
+		TEST(
+			! inclus && contre_exemple && strcmp( contre_exemple, mot ) == 0,
+			result
+		);
+		xfree( contre_exemple );
+
+		inclus = est_inclus( automate_b, automate_a, NULL );
+		TEST( inclus, result );
+
+		liberer_automate( automate_b );
+		liberer_automate( automate_a );
+	}
+
+	return result;
+}
+
+int test_est_universel(){
+	int result = 1;
+
+	{
+		// Les mots dont l'avant-dernière lettre est un a, ou qui finissent 
+		// par a ou par b, ou de longueur au plus 1 : tous les mots sur {a, b}.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 0 );
+		ajouter_transition( automate, 0, 'a', 2 );
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 1, 'b', 2 );
+		ajouter_transition( automate, 0, 'b', 2 );
+		ajouter_transition( automate, 3, 'a', 4 );
+		ajouter_transition( automate, 3, 'b', 4 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_initial( automate, 3 );
+		ajouter_etat_final( automate, 2 );
+		ajouter_etat_final( automate, 3 );
+		ajouter_etat_final( automate, 4 );
+
+		char * contre_exemple = (char *) "x";
+		int universel = est_universel( automate, &contre_exemple );
+		TEST( universel && contre_exemple == NULL, result );
+
+		liberer_automate( automate );
+	}
+
+	{
+		// Sans les mots de longueur au plus 1 ni ceux qui finissent par a, 
+		// il manque le mot vide, a et ba.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, 0, 'a', 0 );
+		ajouter_transition( automate, 0, 'b', 0 );
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 1, 'b', 2 );
+		ajouter_transition( automate, 0, 'b', 2 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+
+		char * contre_exemple = NULL;
+		int universel = est_universel( automate, &contre_exemple );
+		TEST(
+			! universel && contre_exemple 
+			&& strcmp( contre_exemple, "" ) == 0,
+			result
+		);
+		xfree( contre_exemple );
+
+		ajouter_etat_initial( automate, 3 );
+		ajouter_etat_final( automate, 3 );
+		universel = est_universel( automate, &contre_exemple );
+		TEST(
+			! universel && contre_exemple 
+			&& strcmp( contre_exemple, "a" ) == 0
+			&& ! le_mot_est_reconnu( automate, contre_exemple ),
+			result
+		);
+		xfree( contre_exemple );
+
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_est_inclus() ){ return 1; };
+	if( ! test_est_universel() ){ return 1; };
+
+	return 0;
+	
+}
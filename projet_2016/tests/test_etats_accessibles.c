@@ -2,6 +2,8 @@
 #include "outils.h"
 #include "ensemble.h"
 
+#include <string.h>
+
 int test_etats_accessibles(){
 	int result = 1;
 
@@ -29,6 +31,72 @@ int test_etats_accessibles(){
 		liberer_automate( automate );
 	}
 
+	{
+		// Plusieurs états initiaux, un état isolé et un état hors de
+		// l'automate.
+		Automate * automate = creer_automate();
+
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 3, 'b', 4 );
+		ajouter_transition( automate, 4, 'b', 3 );
+		ajouter_transition( automate, 5, 'a', 1 );
+		ajouter_etat( automate, 6 );
+		ajouter_etat_initial( automate, 1 );
+		ajouter_etat_initial( automate, 3 );
+
+		Ensemble * ens = accessibles( automate );
+		TEST(
+			1
+			&& taille_ensemble( ens ) == 4
+			&& est_dans_l_ensemble( ens, 1 )
+			&& est_dans_l_ensemble( ens, 2 )
+			&& est_dans_l_ensemble( ens, 3 )
+			&& est_dans_l_ensemble( ens, 4 )
+			, result
+		);
+		liberer_ensemble( ens );
+
+		ens = etats_accessibles( automate, 6 );
+		TEST( 
+			taille_ensemble( ens ) == 1 && est_dans_l_ensemble( ens, 6 ), 
+			result
+		);
+		liberer_ensemble( ens );
+
+		ens = etats_accessibles( automate, 7 );
+		TEST( 
+			taille_ensemble( ens ) == 1 && est_dans_l_ensemble( ens, 7 ), 
+			result
+		);
+		liberer_ensemble( ens );
+		liberer_automate( automate );
+	}
+
+	{
+		// Une longue chaîne : le parcours ne doit pas dépendre de la
+		// taille de la pile.
+		const int taille = 1 << 20;
+		char * mot = xmalloc( taille + 1 );
+		memset( mot, 'a', taille );
+		mot[ taille ] = '\0';
+		Automate * automate = mot_to_automate( mot );
+
+		Ensemble * ens = accessibles( automate );
+		TEST(
+			1
+			&& taille_ensemble( ens ) == taille + 1
+			&& est_dans_l_ensemble( ens, taille )
+			, result
+		);
+		liberer_ensemble( ens );
+
+		ens = etats_accessibles( automate, taille - 2 );
+		TEST( taille_ensemble( ens ) == 3, result );
+		liberer_ensemble( ens );
+		liberer_automate( automate );
+		xfree( mot );
+	}
+
 	return result;
 }
 
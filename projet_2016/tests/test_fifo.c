@@ -0,0 +1,214 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "fifo.h"
+#include "outils.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+int test_fifo(){
+	int result = 1;
+	Fifo * fifo = creer_fifo();
+
+	TEST( est_vide( fifo ), result );
+	ajouter_fifo( fifo, 1 );
+	ajouter_fifo( fifo, 2 );
+	ajouter_fifo( fifo, 3 );
+	TEST( taille_fifo( fifo ) == 3 && obtenir_fifo( fifo ) == 1, result );
+	intptr_t premier = retirer_fifo( fifo );
+	TEST( premier == 1, result );
+	intptr_t deuxieme = retirer_fifo( fifo );
+	TEST( deuxieme == 2, result );
+
+	// On fait tourner la file dans le tableau pendant qu'il s'agrandit.
+	intptr_t attendu = 3;
+	intptr_t prochain = 4;
+	for( int i = 0; i < 1000; i++ ){
+		ajouter_fifo( fifo, prochain++ );
+		ajouter_fifo( fifo, prochain++ );
+		intptr_t element = retirer_fifo( fifo );
+		TEST( element == attendu, result );
+		attendu++;
+	}
+	TEST( taille_fifo( fifo ) == 1001, result );
+	while( ! est_vide( fifo ) ){
+		intptr_t element = retirer_fifo( fifo );
+		TEST( element == attendu, result );
+		attendu++;
+	}
+	TEST( attendu == prochain, result );
+
+	liberer_fifo( fifo );
+	return result;
+}
+
+int test_elements_fifo(){
+	int result = 1;
+	Fifo * fifo = creer_fifo();
+	intptr_t elements[100];
+	intptr_t lus[100];
+
+	for( int i = 0; i < 100; i++ ){
+		elements[i] = i;
+	}
+	// Le début de la file est décalé pour que les lots fassent le tour du 
+	// tableau.
+	for( int i = 0; i < 10; i++ ){
+		ajouter_fifo( fifo, -1 );
+		retirer_fifo( fifo );
+	}
+	ajouter_elements_fifo( fifo, elements, 10 );
+	ajouter_elements_fifo( fifo, elements + 10, 90 );
+	ajouter_fifo( fifo, 100 );
+	TEST( taille_fifo( fifo ) == 101, result );
+
+	size_t nb = retirer_elements_fifo( fifo, lus, 7 );
+	TEST( nb == 7, result );
+	for( int i = 0; i < 7; i++ ){
+		TEST( lus[i] == i, result );
+	}
+	nb = retirer_elements_fifo( fifo, lus, 100 );
+	TEST( nb == 94, result );
+	for( int i = 0; i < 93; i++ ){
+		TEST( lus[i] == i + 7, result );
+	}
+	TEST( lus[93] == 100, result );
+	TEST( est_vide( fifo ), result );
+	nb = retirer_elements_fifo( fifo, lus, 100 );
+	TEST( nb == 0, result );
+
+	liberer_fifo( fifo );
+	return result;
+}
+
+int test_deque(){
+	int result = 1;
+	Deque * deque = creer_deque();
+	intptr_t element;
+	Etat_deque etat;
+
+	etat = reprendre_deque( deque, &element );
+	TEST( etat == DEQUE_VIDE, result );
+	etat = voler_deque( deque, &element );
+	TEST( etat == DEQUE_VIDE, result );
+	for( int i = 0; i < 100; i++ ){
+		ajouter_deque( deque, i );
+	}
+	// Le propriétaire reprend par le bas, les voleurs prennent par le haut.
+	etat = reprendre_deque( deque, &element );
+	TEST( etat == DEQUE_SUCCES && element == 99, result );
+	etat = voler_deque( deque, &element );
+	TEST( etat == DEQUE_SUCCES && element == 0, result );
+	for( int i = 98; i >= 1; i-- ){
+		etat = reprendre_deque( deque, &element );
+		TEST( etat == DEQUE_SUCCES && element == i, result );
+	}
+	etat = reprendre_deque( deque, &element );
+	TEST( etat == DEQUE_VIDE, result );
+	etat = voler_deque( deque, &element );
+	TEST( etat == DEQUE_VIDE, result );
+
+	liberer_deque( deque );
+	return result;
+}
+
+#define NB_VOLEURS 3
+#define NB_TACHES 100000
+
+typedef struct {
+	Deque * deque;
+	atomic_int * pris;
+	atomic_int * fini;
+} Donnees_voleur;
+
+static void* voler( void* data ){
+	Donnees_voleur * d = (Donnees_voleur *) data;
+	intptr_t element;
+	while( ! atomic_load( d->fini ) ){
+		if( voler_deque( d->deque, &element ) == DEQUE_SUCCES ){
+			atomic_fetch_add( &d->pris[ element ], 1 );
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Le propriétaire ajoute et reprend des tâches pendant que des voleurs en 
+ * prennent : chaque tâche doit être prise exactement une fois.
+ */
+int test_deque_concurrente(){
+	int result = 1;
+	Deque * deque = creer_deque();
+	atomic_int * pris = xmalloc( NB_TACHES * sizeof(atomic_int) );
+	atomic_int fini;
+	atomic_init( &fini, 0 );
+	for( int i = 0; i < NB_TACHES; i++ ){
+		atomic_init( &pris[i], 0 );
+	}
+
+	Donnees_voleur donnees = { deque, pris, &fini };
+	pthread_t voleurs[NB_VOLEURS];
+	for( int i = 0; i < NB_VOLEURS; i++ ){
+		pthread_create( &voleurs[i], NULL, voler, &donnees );
+	}
+	intptr_t element;
+	for( int i = 0; i < NB_TACHES; i++ ){
+		ajouter_deque( deque, i );
+		if( i % 3 == 0 && reprendre_deque( deque, &element ) == DEQUE_SUCCES ){
+			atomic_fetch_add( &pris[ element ], 1 );
+		}
+	}
+	while( reprendre_deque( deque, &element ) == DEQUE_SUCCES ){
+		atomic_fetch_add( &pris[ element ], 1 );
+	}
+	atomic_store( &fini, 1 );
+	for( int i = 0; i < NB_VOLEURS; i++ ){
+		pthread_join( voleurs[i], NULL );
+	}
+
+	int une_fois = 1;
+	for( int i = 0; i < NB_TACHES; i++ ){
+		une_fois &= atomic_load( &pris[i] ) == 1;
+	}
+	TEST( une_fois, result );
+
+	xfree( pris );
+	liberer_deque( deque );
+	return result;
+}
+
+int main(){
+	int result = 1;
+
+	result &= test_fifo();
+	result &= test_elements_fifo();
+	result &= test_deque();
+	result &= test_deque_concurrente();
+
+	if( ! result ){
+		fprintf( stderr, "Certains tests du fichier %s ont échoués.\n", __FILE__ );
+		return 1;
+	}
+
+	return 0;
+}
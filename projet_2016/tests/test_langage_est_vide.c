@@ -0,0 +1,113 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "outils.h"
+
+#include <string.h>
+
+int test_langage_est_vide(){
+	int result = 1;
+
+	{
+		Automate * automate = creer_automate();
+		TEST( langage_est_vide( automate ), result );
+		char * mot = plus_court_mot_reconnu( automate );
+		TEST( mot == NULL, result );
+
+		// Un état final qui n'est pas accessible.
+		ajouter_transition( automate, 0, 'a', 1 );
+		ajouter_transition( automate, 2, 'b', 1 );
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, 2 );
+		TEST( langage_est_vide( automate ), result );
+		mot = plus_court_mot_reconnu( automate );
+		TEST( mot == NULL, result );
+
+		ajouter_transition( automate, 1, 'c', 2 );
+		TEST( ! langage_est_vide( automate ), result );
+		mot = plus_court_mot_reconnu( automate );
+		TEST( mot && strcmp( mot, "ac" ) == 0, result );
+		xfree( mot );
+
+		ajouter_etat_final( automate, 0 );
+		mot = plus_court_mot_reconnu( automate );
+		TEST( mot && strcmp( mot, "" ) == 0, result );
+		xfree( mot );
+
+		liberer_automate( automate );
+	}
+
+	{
+		// Le plus court chemin n'est pas celui des plus petits états.
+		Automate * automate = creer_automate();
+		ajouter_transition( automate, -5, 'a', 1 );
+		ajouter_transition( automate, 1, 'a', 2 );
+		ajouter_transition( automate, 2, 'a', 3 );
+		ajouter_transition( automate, -5, 'z', 7 );
+		ajouter_transition( automate, 7, 'y', 3 );
+		ajouter_transition( automate, 10, 'x', 3 );
+		ajouter_etat_initial( automate, -5 );
+		ajouter_etat_initial( automate, 10 );
+		ajouter_etat_final( automate, 3 );
+
+		char * mot = plus_court_mot_reconnu( automate );
+		TEST( 
+			mot && strcmp( mot, "x" ) == 0 
+			&& le_mot_est_reconnu( automate, mot ),
+			result 
+		);
+		xfree( mot );
+
+		liberer_automate( automate );
+	}
+
+	{
+		// Une longue chaîne.
+		int n = 100000;
+		Automate * automate = creer_automate();
+		for( int i = 0; i < n; i++ ){
+			ajouter_transition( automate, i, 'a', i+1 );
+			ajouter_transition( automate, i, 'b', i );
+		}
+		ajouter_etat_initial( automate, 0 );
+		ajouter_etat_final( automate, n );
+
+		char * mot = plus_court_mot_reconnu( automate );
+		int ok = mot && (int) strlen( mot ) == n;
+		for( int i = 0; ok && i < n; i++ ){
+			ok = mot[i] == 'a';
+		}
+		TEST( ok, result );
+		xfree( mot );
+
+		liberer_automate( automate );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_langage_est_vide() ){ return 1; };
+
+	return 0;
+	
+}
@@ -0,0 +1,250 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "automate.h"
+#include "automate_compile.h"
+#include "outils.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * Reconnaît les mots dont la n-ième lettre avant la fin est un 'a'. Si 
+ * 'sens' vaut -1, les états sont numérotés à l'envers.
+ */
+Automate * creer_automate_nieme_lettre( int n, int sens ){
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_transition( automate, 0, 'b', 0 );
+	ajouter_transition( automate, 0, 'a', sens );
+	for( int i = 1; i < n; i++ ){
+		ajouter_transition( automate, sens * i, 'a', sens * ( i+1 ) );
+		ajouter_transition( automate, sens * i, 'b', sens * ( i+1 ) );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, sens * n );
+	return automate;
+}
+
+/*
+ * Lit le mot par morceaux de tailles pseudo-aléatoires.
+ */
+int lire_par_morceaux( 
+	const Automate_compile * compile, const char * mot, unsigned int graine
+){
+	Lecteur_compile * lecteur = debut_lecture_compile( compile );
+	size_t taille = strlen( mot );
+	size_t debut = 0;
+	while( debut < taille ){
+		graine = graine * 1103515245u + 12345u;
+		size_t nb = ( graine >> 16 ) % 7;
+		if( nb > taille - debut ){
+			nb = taille - debut;
+		}
+		nourrir_lecture_compile( lecteur, mot + debut, nb );
+		debut += nb;
+	}
+	return fin_lecture_compile( lecteur );
+}
+
+int test_lecture_par_morceaux(){
+	int result = 1;
+	char mot[301];
+
+	// 3 états lus par masques, 3000 états lus par listes.
+	for( int n = 3; n <= 3000; n *= 1000 ){
+		for( int sens = -1; sens <= 1; sens += 2 ){
+			Automate * automate = creer_automate_nieme_lettre( n, sens );
+			Automate_compile * compile = compiler_automate( automate );
+			unsigned int graine = 7;
+			int identiques = 1;
+			for( int i = 0; i < 200; i++ ){
+				int taille = i % 300;
+				for( int j = 0; j < taille; j++ ){
+					graine = graine * 1103515245u + 12345u;
+					mot[j] = "ab"[ ( graine >> 16 ) & 1 ];
+				}
+				mot[taille] = '\0';
+				identiques &= 
+					lire_par_morceaux( compile, mot, i ) == 
+					le_mot_est_reconnu_compile( compile, mot );
+			}
+			TEST( identiques, result );
+			liberer_automate_compile( compile );
+			liberer_automate( automate );
+		}
+	}
+
+	Automate * automate = creer_automate_nieme_lettre( 3, 1 );
+	Automate_compile * compile = compiler_automate( automate );
+
+	// Un '\0' est une lettre comme une autre, qui n'est pas dans l'alphabet.
+	// TEST() évalue deux fois son argument : on garde les résultats.
+	Lecteur_compile * lecteur = debut_lecture_compile( compile );
+	int non_vide = nourrir_lecture_compile( lecteur, "ab", 2 );
+	TEST( non_vide, result );
+	non_vide = nourrir_lecture_compile( lecteur, "a\0b", 3 );
+	TEST( ! non_vide, result );
+	non_vide = nourrir_lecture_compile( lecteur, "aaa", 3 );
+	TEST( ! non_vide, result );
+	int reconnu = fin_lecture_compile( lecteur );
+	TEST( ! reconnu, result );
+
+	lecteur = debut_lecture_compile( compile );
+	non_vide = nourrir_lecture_compile( lecteur, "abbxx", 3 );
+	TEST( non_vide, result );
+	reconnu = fin_lecture_compile( lecteur );
+	TEST( reconnu, result );
+
+	liberer_automate_compile( compile );
+	liberer_automate( automate );
+	return result;
+}
+
+/*
+ * Écrit 'taille' octets dans un nouveau fichier temporaire dont le chemin 
+ * est écrit dans 'chemin'.
+ */
+void ecrire_fichier( char * chemin, const char * contenu, size_t taille ){
+	strcpy( chemin, "/tmp/test_lecture_XXXXXX" );
+	int fd = mkstemp( chemin );
+	if( fd < 0 ){
+		ERREUR( "Impossible de créer un fichier temporaire" );
+	}
+	while( taille > 0 ){
+		ssize_t nb = write( fd, contenu, taille );
+		if( nb <= 0 ){
+			ERREUR( "Impossible d'écrire le fichier temporaire" );
+		}
+		contenu += nb;
+		taille -= nb;
+	}
+	close( fd );
+}
+
+int test_le_fichier_est_reconnu(){
+	int result = 1;
+	char chemin[64];
+	int reconnu;
+
+	Automate * automate = creer_automate_nieme_lettre( 3, 1 );
+
+	reconnu = le_fichier_est_reconnu( automate, "/ce/fichier/n/existe/pas" );
+	TEST( reconnu == -1, result );
+
+	ecrire_fichier( chemin, "", 0 );
+	reconnu = le_fichier_est_reconnu( automate, chemin );
+	TEST( reconnu == 0, result );
+	unlink( chemin );
+
+	// Plus de 16 Mo : le fichier est lu en plusieurs morceaux.
+	size_t taille = ( (size_t) 1 << 24 ) + 1000;
+	char * contenu = xmalloc( taille );
+	memset( contenu, 'b', taille );
+	contenu[ taille - 3 ] = 'a';
+	ecrire_fichier( chemin, contenu, taille );
+	reconnu = le_fichier_est_reconnu( automate, chemin );
+	TEST( reconnu == 1, result );
+	unlink( chemin );
+
+	contenu[ taille - 3 ] = 'b';
+	contenu[ taille - 2 ] = 'a';
+	ecrire_fichier( chemin, contenu, taille );
+	reconnu = le_fichier_est_reconnu( automate, chemin );
+	TEST( reconnu == 0, result );
+	unlink( chemin );
+
+	// Une lettre hors de l'alphabet arrête la lecture.
+	contenu[10] = 'z';
+	contenu[ taille - 3 ] = 'a';
+	ecrire_fichier( chemin, contenu, taille );
+	reconnu = le_fichier_est_reconnu( automate, chemin );
+	TEST( reconnu == 0, result );
+	unlink( chemin );
+
+	xfree( contenu );
+	liberer_automate( automate );
+	return result;
+}
+
+/*
+ * Les fichiers qui ne sont pas projetés en mémoire : un tube, et un fichier
+ * de /proc, qui annonce une taille nulle.
+ */
+int test_le_fichier_est_reconnu_sans_projection(){
+	int result = 1;
+	char chemin[64];
+	int reconnu;
+
+	// Reconnaît tous les mots.
+	Automate * tous_les_mots = creer_automate();
+	for( int octet = 1; octet < 256; octet++ ){
+		ajouter_transition( tous_les_mots, 0, (char) octet, 0 );
+	}
+	ajouter_etat_initial( tous_les_mots, 0 );
+	ajouter_etat_final( tous_les_mots, 0 );
+
+	// Ne reconnaît que le mot vide.
+	Automate * mot_vide = creer_automate();
+	ajouter_etat_initial( mot_vide, 0 );
+	ajouter_etat_final( mot_vide, 0 );
+
+	Automate * automate = creer_automate_nieme_lettre( 3, 1 );
+	int tube[2];
+	if( pipe( tube ) != 0 ){
+		ERREUR( "Impossible de créer un tube" );
+	}
+	if( write( tube[1], "bbbabb", 6 ) != 6 ){
+		ERREUR( "Impossible d'écrire dans le tube" );
+	}
+	close( tube[1] );
+	snprintf( chemin, sizeof( chemin ), "/proc/self/fd/%d", tube[0] );
+	if( access( chemin, R_OK ) == 0 ){
+		reconnu = le_fichier_est_reconnu( automate, chemin );
+		TEST( reconnu == 1, result );
+	}
+	close( tube[0] );
+
+	if( access( "/proc/self/status", R_OK ) == 0 ){
+		reconnu = le_fichier_est_reconnu( mot_vide, "/proc/self/status" );
+		TEST( reconnu == 0, result );
+		reconnu = le_fichier_est_reconnu( tous_les_mots, "/proc/self/status" );
+		TEST( reconnu == 1, result );
+	}
+
+	liberer_automate( automate );
+	liberer_automate( mot_vide );
+	liberer_automate( tous_les_mots );
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_lecture_par_morceaux() ){ return 1; }
+	if( ! test_le_fichier_est_reconnu() ){ return 1; }
+	if( ! test_le_fichier_est_reconnu_sans_projection() ){ return 1; }
+
+	return 0;
+}
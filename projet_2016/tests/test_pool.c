@@ -0,0 +1,136 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "pool.h"
+#include "outils.h"
+
+#include <stdint.h>
+#include <string.h>
+
+int test_allouer_pool(){
+	int result = 1;
+	Pool * pool = creer_pool();
+	int i;
+	char * blocs[1000];
+
+	for( i=0; i<1000; i++ ){
+		blocs[i] = allouer_pool( pool, 1 + i % 100 );
+		memset( blocs[i], i % 256, 1 + i % 100 );
+		TEST( ( (uintptr_t) blocs[i] ) % POOL_GRANULARITE == 0, result );
+	}
+	for( i=0; i<1000; i++ ){
+		TEST( blocs[i][0] == (char) ( i % 256 ), result );
+		TEST( blocs[i][ i % 100 ] == (char) ( i % 256 ), result );
+	}
+
+	// Un gros bloc a son propre tronçon.
+	char * gros = allouer_pool( pool, 1 << 20 );
+	memset( gros, 1, 1 << 20 );
+	TEST( gros[ (1 << 20) - 1 ] == 1, result );
+
+	liberer_pool( pool );
+	return result;
+}
+
+int test_rendre_pool(){
+	int result = 1;
+	Pool * pool = creer_pool();
+
+	void * a = allouer_pool( pool, 40 );
+	void * b = allouer_pool( pool, 40 );
+	rendre_pool( pool, a, 40 );
+	// Un bloc rendu est réutilisé par une allocation de la même classe...
+	TEST( allouer_pool( pool, 33 ) == a, result );
+	rendre_pool( pool, b, 40 );
+	// ... mais pas par une allocation d'une autre classe.
+	TEST( allouer_pool( pool, 16 ) != b, result );
+	TEST( allouer_pool( pool, 48 ) == b, result );
+
+	liberer_pool( pool );
+	return result;
+}
+
+int test_vider_pool(){
+	int result = 1;
+	Pool pool;
+	initialiser_pool( &pool );
+	int i;
+	for( i=0; i<10000; i++ ){
+		allouer_pool( &pool, 32 );
+	}
+	vider_pool( &pool );
+	TEST( pool.troncons == NULL, result );
+	int * entier = allouer_pool( &pool, sizeof(int) );
+	*entier = 42;
+	TEST( *entier == 42, result );
+	vider_pool( &pool );
+	return result;
+}
+
+int comparer_entiers( const void * a, const void * b, void * param ){
+	return *(const int*) a - *(const int*) b;
+}
+
+int test_allocateur_avl_pool(){
+	int result = 1;
+	Pool * pool = creer_pool();
+	int valeurs[100];
+	int i;
+
+	struct avl_table * arbre = avl_create(
+		comparer_entiers, NULL, allocateur_avl_pool( pool )
+	);
+	for( i=0; i<100; i++ ){
+		valeurs[i] = ( i * 37 ) % 100;
+		avl_insert( arbre, &valeurs[i] );
+	}
+	for( i=0; i<100; i+=2 ){
+		avl_delete( arbre, &valeurs[i] );
+	}
+	// Les noeuds libérés par libavl sont réutilisés.
+	for( i=0; i<100; i+=2 ){
+		avl_insert( arbre, &valeurs[i] );
+	}
+	TEST( avl_count( arbre ) == 100, result );
+	for( i=0; i<100; i++ ){
+		TEST( avl_find( arbre, &i ) != NULL, result );
+	}
+
+	// L'arbre est détruit avec le pool, sans avl_destroy().
+	liberer_pool( pool );
+	return result;
+}
+
+int main(){
+	int result = 1;
+
+	result &= test_allouer_pool();
+	result &= test_rendre_pool();
+	result &= test_vider_pool();
+	result &= test_allocateur_avl_pool();
+
+	if( ! result ){
+		fprintf( stderr, "Certains tests du fichier %s ont échoués.\n", __FILE__ );
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,225 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "produit.h"
+#include "automate.h"
+#include "outils.h"
+
+#include <string.h>
+
+/*
+ * Recopie dans 'projection' les lettres du mot qui sont dans l'alphabet de
+ * l'automate.
+ */
+static void projeter( 
+	const char * mot, const Automate * automate, char * projection 
+){
+	int n = 0;
+	for( const char * p = mot; *p; p++ ){
+		if( est_une_lettre_de_l_automate( automate, *p ) ){
+			projection[ n++ ] = *p;
+		}
+	}
+	projection[n] = '\0';
+}
+
+static int reconnu_par_le_produit_construit( 
+	const Automate * aut1, const Automate * aut2, Type_produit type,
+	const char * mot
+){
+	if( type == PRODUIT_INTERSECTION ){
+		return le_mot_est_reconnu( aut1, mot ) && le_mot_est_reconnu( aut2, mot );
+	}
+	if( type == PRODUIT_MELANGE ){
+		return le_mot_est_dans_le_melange( aut1, aut2, mot );
+	}
+	char projection_1[16], projection_2[16];
+	projeter( mot, aut1, projection_1 );
+	projeter( mot, aut2, projection_2 );
+	return 
+		le_mot_est_reconnu( aut1, projection_1 )
+		&& le_mot_est_reconnu( aut2, projection_2 );
+}
+
+/*
+ * Compare la vue, et l'automate construit à partir d'elle, à la définition
+ * du produit sur tous les mots de longueur au plus 'longueur_max' sur 
+ * l'alphabet 'lettres'.
+ */
+static int comparer_au_produit(
+	const Automate * aut1, const Automate * aut2, Type_produit type,
+	const char * lettres, int longueur_max
+){
+	Produit * produit = creer_produit( aut1, aut2, type );
+	Automate * construit = construire_produit( produit );
+	int nb_lettres = strlen( lettres );
+	int identiques = 1;
+	int vide = 1;
+	char mot[16];
+	int indices[16];
+	for( int longueur = 0; longueur <= longueur_max; longueur++ ){
+		for( int i = 0; i < longueur; i++ ){
+			indices[i] = 0;
+		}
+		for( ;; ){
+			for( int i = 0; i < longueur; i++ ){
+				mot[i] = lettres[ indices[i] ];
+			}
+			mot[ longueur ] = '\0';
+			int attendu = reconnu_par_le_produit_construit( aut1, aut2, type, mot );
+			identiques &= le_mot_est_reconnu_produit( produit, mot ) == attendu;
+			if( type == PRODUIT_SYNCHRONE ){
+				char projection[16];
+				projeter( mot, construit, projection );
+				identiques &= le_mot_est_reconnu( construit, projection ) == attendu;
+			}else{
+				identiques &= le_mot_est_reconnu( construit, mot ) == attendu;
+			}
+			vide &= ! attendu;
+			int i = 0;
+			while( i < longueur && ++indices[i] == nb_lettres ){
+				indices[i++] = 0;
+			}
+			if( i == longueur ){
+				break;
+			}
+		}
+	}
+	// Les automates testés reconnaissent, s'ils en reconnaissent, des mots
+	// courts.
+	identiques &= produit_est_vide( produit ) == vide;
+	liberer_automate( construit );
+	liberer_produit( produit );
+	return identiques;
+}
+
+int test_produit(){
+	int result = 1;
+
+	Automate * aut1 = creer_automate();
+	ajouter_transition( aut1, 0, 'a', 1 );
+	ajouter_transition( aut1, 0, 'a', 0 );
+	ajouter_transition( aut1, 1, 'b', 2 );
+	ajouter_transition( aut1, 2, 'a', 2 );
+	ajouter_transition( aut1, 2, 'b', 1 );
+	ajouter_etat_initial( aut1, 0 );
+	ajouter_etat_final( aut1, 1 );
+
+	Automate * aut2 = creer_automate();
+	ajouter_transition( aut2, 0, 'a', 1 );
+	ajouter_transition( aut2, 1, 'c', 1 );
+	ajouter_transition( aut2, 0, 'c', 0 );
+	ajouter_transition( aut2, 1, 'a', 0 );
+	ajouter_etat_initial( aut2, 0 );
+	ajouter_etat_final( aut2, 1 );
+
+	Automate * aut3 = mot_to_automate( "ab" );
+	Automate * aut4 = mot_to_automate( "ac" );
+
+	TEST( comparer_au_produit( aut1, aut2, PRODUIT_INTERSECTION, "abc", 6 ), result );
+	TEST( comparer_au_produit( aut1, aut2, PRODUIT_SYNCHRONE, "abcd", 5 ), result );
+	// z n'est dans aucun des deux alphabets.
+	TEST( comparer_au_produit( aut1, aut2, PRODUIT_INTERSECTION, "abz", 5 ), result );
+	TEST( comparer_au_produit( aut1, aut2, PRODUIT_SYNCHRONE, "acz", 5 ), result );
+	TEST( comparer_au_produit( aut3, aut4, PRODUIT_INTERSECTION, "abc", 4 ), result );
+	TEST( comparer_au_produit( aut3, aut4, PRODUIT_SYNCHRONE, "abc", 4 ), result );
+	TEST( comparer_au_produit( aut1, aut2, PRODUIT_MELANGE, "acz", 5 ), result );
+	TEST( comparer_au_produit( aut3, aut4, PRODUIT_MELANGE, "abc", 5 ), result );
+
+	Produit * produit = creer_produit( aut3, aut4, PRODUIT_SYNCHRONE );
+	TEST(
+		1
+		&& le_mot_est_reconnu_produit( produit, "abc" )
+		&& le_mot_est_reconnu_produit( produit, "acb" )
+		&& ! le_mot_est_reconnu_produit( produit, "aabc" )
+		&& le_mot_est_reconnu_produit( produit, "zazbzcz" )
+		&& ! le_mot_est_reconnu_produit( produit, "zazbz" )
+		&& couple_est_accessible_produit( produit, 2, 2 )
+		&& couple_est_accessible_produit( produit, 1, 2 )
+		&& ! couple_est_accessible_produit( produit, 0, 1 )
+		, result
+	);
+	liberer_produit( produit );
+
+	produit = creer_produit( aut3, aut4, PRODUIT_INTERSECTION );
+	TEST(
+		1
+		&& produit_est_vide( produit )
+		&& couple_est_accessible_produit( produit, 1, 1 )
+		&& ! couple_est_accessible_produit( produit, 2, 2 )
+		, result
+	);
+	liberer_produit( produit );
+
+	liberer_automate( aut1 );
+	liberer_automate( aut2 );
+	liberer_automate( aut3 );
+	liberer_automate( aut4 );
+	return result;
+}
+
+/*
+ * Le produit de deux automates de 100001 états en a 10^10, mais seuls 
+ * 100001 couples sont accessibles.
+ */
+int test_produit_grand(){
+	int result = 1;
+
+	const int taille = 100000;
+	char * mot = xmalloc( taille + 2 );
+	memset( mot, 'a', taille );
+	mot[ taille ] = '\0';
+	Automate * aut1 = mot_to_automate( mot );
+	ajouter_transition( aut1, taille, 'a', taille );
+	Automate * aut2 = mot_to_automate( mot );
+	ajouter_transition( aut2, 0, 'b', 0 );
+
+	Produit * produit = creer_produit( aut1, aut2, PRODUIT_INTERSECTION );
+	TEST( ! produit_est_vide( produit ), result );
+	TEST( couple_est_accessible_produit( produit, taille, taille ), result );
+	TEST( ! couple_est_accessible_produit( produit, taille, 0 ), result );
+	int reconnu = le_mot_est_reconnu_produit( produit, mot );
+	TEST( reconnu, result );
+	mot[ taille ] = 'a';
+	mot[ taille + 1 ] = '\0';
+	reconnu = le_mot_est_reconnu_produit( produit, mot );
+	TEST( ! reconnu, result );
+	liberer_produit( produit );
+
+	liberer_automate( aut1 );
+	liberer_automate( aut2 );
+	xfree( mot );
+	return result;
+}
+
+int main(){
+	int result = 1;
+
+	result &= test_produit();
+	result &= test_produit_grand();
+
+	if( ! result ){
+		fprintf( stderr, "Certains tests du fichier %s ont échoués.\n", __FILE__ );
+		return 1;
+	}
+
+	return 0;
+}
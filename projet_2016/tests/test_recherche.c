@@ -0,0 +1,258 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2015 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "recherche.h"
+#include "outils.h"
+
+#include <string.h>
+
+#define NB_MAX_OCCURRENCES 1000
+
+typedef struct {
+	size_t debuts[ NB_MAX_OCCURRENCES ];
+	size_t fins[ NB_MAX_OCCURRENCES ];
+	size_t nb;
+} Occurrences;
+
+void action_noter_occurrence( size_t debut, size_t fin, void * data ){
+	Occurrences * occurrences = (Occurrences *) data;
+	if( occurrences->nb < NB_MAX_OCCURRENCES ){
+		occurrences->debuts[ occurrences->nb ] = debut;
+		occurrences->fins[ occurrences->nb ] = fin;
+	}
+	occurrences->nb++;
+}
+
+/*
+ * Vérifie que les occurrences trouvées sont les couples (debut, fin) du 
+ * tableau 'attendues', qui se termine par -1.
+ */
+int verifier_occurrences( const Occurrences * occurrences, const int * attendues ){
+	size_t nb = 0;
+	while( attendues[ 2*nb ] >= 0 ){
+		if( 
+			nb >= occurrences->nb
+			|| occurrences->debuts[nb] != (size_t) attendues[ 2*nb ]
+			|| occurrences->fins[nb] != (size_t) attendues[ 2*nb + 1 ]
+		){
+			return 0;
+		}
+		nb++;
+	}
+	return nb == occurrences->nb;
+}
+
+int chercher_et_verifier(
+	const Recherche * recherche, const char * texte, 
+	Politique_recherche politique, const int * attendues
+){
+	Occurrences occurrences;
+	occurrences.nb = 0;
+	size_t nb = rechercher( 
+		recherche, texte, strlen( texte ), politique, 
+		action_noter_occurrence, &occurrences 
+	);
+	return nb == occurrences.nb && verifier_occurrences( &occurrences, attendues );
+}
+
+int test_rechercher(){
+	int result = 1;
+
+	// Reconnaît "ab", "abcd" et "c".
+	Automate * automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 1 );
+	ajouter_transition( automate, 1, 'b', 2 );
+	ajouter_transition( automate, 2, 'c', 3 );
+	ajouter_transition( automate, 3, 'd', 4 );
+	ajouter_transition( automate, 0, 'c', 4 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 2 );
+	ajouter_etat_final( automate, 4 );
+	Recherche * recherche = creer_recherche( automate );
+	liberer_automate( automate );
+
+	int toutes[] = { 1, 3, 3, 4, 1, 5, 6, 7, 7, 9, -1 };
+	TEST( 
+		chercher_et_verifier( recherche, "xabcdxcab", RECHERCHE_TOUTES, toutes ),
+		result 
+	);
+	int plus_longues[] = { 1, 5, 6, 7, 7, 9, -1 };
+	TEST( 
+		chercher_et_verifier( 
+			recherche, "xabcdxcab", RECHERCHE_PLUS_LONGUE_A_GAUCHE, plus_longues 
+		), 
+		result 
+	);
+	int aucune[] = { -1 };
+	TEST( 
+		chercher_et_verifier( recherche, "", RECHERCHE_TOUTES, aucune ), 
+		result 
+	);
+	TEST( 
+		chercher_et_verifier( 
+			recherche, "xxaxb", RECHERCHE_PLUS_LONGUE_A_GAUCHE, aucune 
+		), 
+		result 
+	);
+	liberer_recherche( recherche );
+
+	// Reconnaît a*, dont le mot vide.
+	automate = creer_automate();
+	ajouter_transition( automate, 0, 'a', 0 );
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, 0 );
+	recherche = creer_recherche( automate );
+	liberer_automate( automate );
+
+	int toutes_vides[] = { 0, 0, 1, 1, 1, 2, 1, 3, 4, 4, -1 };
+	TEST( 
+		chercher_et_verifier( recherche, "baab", RECHERCHE_TOUTES, toutes_vides ), 
+		result 
+	);
+	int plus_longues_vides[] = { 0, 0, 1, 3, 3, 3, 4, 4, -1 };
+	TEST( 
+		chercher_et_verifier( 
+			recherche, "baab", RECHERCHE_PLUS_LONGUE_A_GAUCHE, 
+			plus_longues_vides 
+		), 
+		result 
+	);
+	liberer_recherche( recherche );
+
+	return result;
+}
+
+/*
+ * Automate pseudo-aléatoire à nb_etats états sur l'alphabet {a, b}.
+ */
+Automate * creer_automate_aleatoire( int nb_etats, unsigned int graine ){
+	Automate * automate = creer_automate();
+	for( int i = 0; i < 3 * nb_etats; i++ ){
+		graine = graine * 1103515245u + 12345u;
+		int origine = ( graine >> 8 ) % nb_etats;
+		graine = graine * 1103515245u + 12345u;
+		int fin = ( graine >> 8 ) % nb_etats;
+		ajouter_transition( automate, origine, "ab"[ i % 2 ], fin );
+	}
+	ajouter_etat_initial( automate, 0 );
+	ajouter_etat_final( automate, nb_etats - 1 );
+	return automate;
+}
+
+/*
+ * Cherche les occurrences en testant tous les facteurs du texte.
+ */
+void chercher_naivement(
+	const Automate * automate, const char * texte, 
+	Politique_recherche politique, Occurrences * occurrences
+){
+	size_t taille = strlen( texte );
+	char * facteur = xmalloc( taille + 1 );
+	occurrences->nb = 0;
+	size_t position = 0;
+	for( size_t fin = 0; fin <= taille; fin++ ){
+		for( size_t debut = 0; debut <= fin; debut++ ){
+			memcpy( facteur, texte + debut, fin - debut );
+			facteur[ fin - debut ] = '\0';
+			if( 
+				politique == RECHERCHE_TOUTES && 
+				le_mot_est_reconnu( automate, facteur ) 
+			){
+				action_noter_occurrence( debut, fin, occurrences );
+				break;
+			}
+		}
+	}
+	while( politique == RECHERCHE_PLUS_LONGUE_A_GAUCHE && position <= taille ){
+		size_t debut, fin, meilleure_fin = 0;
+		int trouve = 0;
+		for( debut = position; debut <= taille && ! trouve; debut++ ){
+			for( fin = debut; fin <= taille; fin++ ){
+				memcpy( facteur, texte + debut, fin - debut );
+				facteur[ fin - debut ] = '\0';
+				if( le_mot_est_reconnu( automate, facteur ) ){
+					trouve = 1;
+					meilleure_fin = fin;
+				}
+			}
+		}
+		if( ! trouve ){
+			break;
+		}
+		debut--;
+		action_noter_occurrence( debut, meilleure_fin, occurrences );
+		position = meilleure_fin > debut ? meilleure_fin : debut + 1;
+	}
+	xfree( facteur );
+}
+
+int test_rechercher_aleatoire(){
+	int result = 1;
+	char texte[61];
+	unsigned int graine = 3;
+
+	// Des automates lus par masques, et d'autres qui sont trop grands pour 
+	// cela.
+	int tailles[] = { 4, 12, 300 };
+	for( int t = 0; t < 3; t++ ){
+		for( int k = 0; k < 5; k++ ){
+			Automate * automate = creer_automate_aleatoire( tailles[t], 17 * k + t );
+			Recherche * recherche = creer_recherche( automate );
+			for( int politique = 0; politique < 2; politique++ ){
+				int identiques = 1;
+				for( int n = 0; n < 10; n++ ){
+					int taille = ( 7 * n ) % 60;
+					for( int i = 0; i < taille; i++ ){
+						graine = graine * 1103515245u + 12345u;
+						texte[i] = "abc"[ ( graine >> 16 ) % 3 ];
+					}
+					texte[taille] = '\0';
+					Occurrences attendues, obtenues;
+					chercher_naivement( automate, texte, politique, &attendues );
+					obtenues.nb = 0;
+					rechercher( 
+						recherche, texte, taille, politique, 
+						action_noter_occurrence, &obtenues 
+					);
+					identiques &= attendues.nb == obtenues.nb;
+					for( size_t i = 0; i < attendues.nb && identiques; i++ ){
+						identiques &= attendues.debuts[i] == obtenues.debuts[i];
+						identiques &= attendues.fins[i] == obtenues.fins[i];
+					}
+				}
+				TEST( identiques, result );
+			}
+			liberer_recherche( recherche );
+			liberer_automate( automate );
+		}
+	}
+
+	return result;
+}
+
+
+int main(){
+
+	if( ! test_rechercher() ){ return 1; }
+	if( ! test_rechercher_aleatoire() ){ return 1; }
+
+	return 0;
+}
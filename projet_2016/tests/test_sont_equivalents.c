@@ -0,0 +1,225 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "automate.h"
+#include "inclusion.h"
+#include "outils.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+static Automate * automate_aleatoire( int nb_etats, int nb_transitions ){
+	Automate * res = creer_automate();
+	for( int i = 0; i < nb_etats; i++ ){
+		ajouter_etat( res, i );
+		if( rand() % 3 == 0 ){
+			ajouter_etat_final( res, i );
+		}
+	}
+	ajouter_etat_initial( res, 0 );
+	if( rand() % 4 == 0 ){
+		ajouter_etat_initial( res, rand() % nb_etats );
+	}
+	for( int i = 0; i < nb_transitions; i++ ){
+		ajouter_transition( 
+			res, rand() % nb_etats, "ab"[ rand() % 2 ], rand() % nb_etats 
+		);
+	}
+	return res;
+}
+
+/*
+ * Le plus court mot de longueur au plus 'longueur_max' reconnu par un seul
+ * des deux automates, ou -1.
+ */
+static int longueur_distinguante( 
+	const Automate * automate_1, const Automate * automate_2, 
+	int longueur_max 
+){
+	char mot[32];
+	for( int longueur = 0; longueur <= longueur_max; longueur++ ){
+		for( long n = 0; n < ( 1L << longueur ); n++ ){
+			for( int i = 0; i < longueur; i++ ){
+				mot[i] = "ab"[ ( n >> i ) & 1 ];
+			}
+			mot[ longueur ] = '\0';
+			if( 
+				le_mot_est_reconnu( automate_1, mot ) 
+				!= le_mot_est_reconnu( automate_2, mot )
+			){
+				return longueur;
+			}
+		}
+	}
+	return -1;
+}
+
+int test_sont_equivalents(){
+	int result = 1;
+
+	{
+		// Deux automates déterministes pour les mots qui ont un nombre 
+		// pair de a, le second avec des états redondants.
+		Automate * automate_1 = creer_automate();
+		ajouter_transition( automate_1, 0, 'a', 1 );
+		ajouter_transition( automate_1, 1, 'a', 0 );
+		ajouter_transition( automate_1, 0, 'b', 0 );
+		ajouter_transition( automate_1, 1, 'b', 1 );
+		ajouter_etat_initial( automate_1, 0 );
+		ajouter_etat_final( automate_1, 0 );
+
+		Automate * automate_2 = creer_automate();
+		ajouter_transition( automate_2, 10, 'a', 11 );
+		ajouter_transition( automate_2, 11, 'a', 12 );
+		ajouter_transition( automate_2, 12, 'a', 13 );
+		ajouter_transition( automate_2, 13, 'a', 10 );
+		for( int e = 10; e < 14; e++ ){
+			ajouter_transition( automate_2, e, 'b', e );
+		}
+		ajouter_etat_initial( automate_2, 10 );
+		ajouter_etat_final( automate_2, 10 );
+		ajouter_etat_final( automate_2, 12 );
+
+		char * mot = (char *) "x";
+		int equivalents = sont_equivalents( automate_1, automate_2, &mot );
+		TEST( equivalents && mot == NULL, result );
+
+		// Une transition qui garde la parité ne change pas le langage.
+		ajouter_transition( automate_2, 11, 'b', 13 );
+		equivalents = sont_equivalents( automate_1, automate_2, &mot );
+		TEST( equivalents && mot == NULL, result );
+
+		// Celle-ci fait reconnaître abb, babb, abbb...
+		ajouter_transition( automate_2, 13, 'b', 12 );
+		equivalents = sont_equivalents( automate_1, automate_2, &mot );
+		TEST( ! equivalents && mot && strcmp( mot, "abb" ) == 0, result );
+		xfree( mot );
+
+		liberer_automate( automate_2 );
+		liberer_automate( automate_1 );
+	}
+
+	{
+		// Un automate déterministe incomplet et un automate non 
+		// déterministe sur un alphabet plus grand, pour a*b.
+		Automate * automate_1 = creer_automate();
+		ajouter_transition( automate_1, 0, 'a', 0 );
+		ajouter_transition( automate_1, 0, 'b', 1 );
+		ajouter_etat_initial( automate_1, 0 );
+		ajouter_etat_final( automate_1, 1 );
+
+		Automate * automate_2 = creer_automate();
+		ajouter_transition( automate_2, 0, 'a', 0 );
+		ajouter_transition( automate_2, 0, 'a', 1 );
+		ajouter_transition( automate_2, 1, 'a', 1 );
+		ajouter_transition( automate_2, 1, 'b', 2 );
+		ajouter_transition( automate_2, 0, 'b', 2 );
+		ajouter_transition( automate_2, 3, 'c', 2 );
+		ajouter_etat_initial( automate_2, 0 );
+		ajouter_etat_final( automate_2, 2 );
+
+		char * mot = NULL;
+		int equivalents = sont_equivalents( automate_1, automate_2, &mot );
+		TEST( equivalents && mot == NULL, result );
+
+		ajouter_etat_initial( automate_2, 3 );
+		equivalents = sont_equivalents( automate_1, automate_2, &mot );
+		TEST( ! equivalents && mot && strcmp( mot, "c" ) == 0, result );
+		xfree( mot );
+
+		liberer_automate( automate_2 );
+		liberer_automate( automate_1 );
+	}
+
+	{
+		// Des automates sans état initial reconnaissent le langage vide.
+		Automate * automate_1 = creer_automate();
+		Automate * automate_2 = mot_to_automate( "ab" );
+		int equivalents = sont_equivalents( automate_1, automate_2, NULL );
+		TEST( ! equivalents, result );
+
+		Automate * automate_3 = creer_automate();
+		ajouter_transition( automate_3, 0, 'a', 1 );
+		ajouter_etat_final( automate_3, 1 );
+		equivalents = sont_equivalents( automate_1, automate_3, NULL );
+		TEST( equivalents, result );
+
+		liberer_automate( automate_3 );
+		liberer_automate( automate_2 );
+		liberer_automate( automate_1 );
+	}
+
+	{
+		// Comparaison avec une énumération des mots courts, et avec le 
+		// déterminisé.
+		srand( 2016 );
+		int ok = 1;
+		for( int n = 0; n < 300 && ok; n++ ){
+			int nb_etats = 1 + rand() % 4;
+			Automate * automate_1 = automate_aleatoire( nb_etats, 2 * nb_etats );
+			Automate * automate_2 = automate_aleatoire( nb_etats, 2 * nb_etats );
+			Automate * deterministe = creer_automate_deterministe( automate_1 );
+			Automate * deterministe_2 = creer_automate_deterministe( automate_2 );
+
+			char * mot = NULL;
+			int equivalents = sont_equivalents( automate_1, automate_2, &mot );
+			int longueur = longueur_distinguante( automate_1, automate_2, 12 );
+			int longueur_mot = mot ? (int) strlen( mot ) : -1;
+			if( equivalents ){
+				ok = ( mot == NULL && longueur < 0 );
+			}else{
+				ok = 
+					mot
+					&& le_mot_est_reconnu( automate_1, mot ) 
+						!= le_mot_est_reconnu( automate_2, mot )
+					&& ( longueur < 0 || longueur_mot == longueur );
+			}
+			xfree( mot );
+
+			// Hopcroft et Karp trouvent un mot de même longueur.
+			int equivalents_dfa = sont_equivalents( 
+				deterministe, deterministe_2, &mot 
+			);
+			ok = ok 
+				&& equivalents_dfa == equivalents 
+				&& ( mot ? (int) strlen( mot ) : -1 ) == longueur_mot;
+			xfree( mot );
+
+			equivalents = sont_equivalents( automate_1, deterministe, &mot );
+			ok = ok && equivalents && mot == NULL;
+
+			liberer_automate( deterministe_2 );
+			liberer_automate( deterministe );
+			liberer_automate( automate_2 );
+			liberer_automate( automate_1 );
+		}
+		TEST( ok, result );
+	}
+
+	return result;
+}
+
+int main(){
+
+	if( ! test_sont_equivalents() ){ return 1; };
+
+	return 0;
+	
+}
@@ -0,0 +1,97 @@
+/*
+ *   Ce fichier fait partie d'un projet de programmation donné en Licence 3 
+ *   à l'Université de Bordeaux
+ *
+ *   Copyright (C) 2016 Adrien Boussicault
+ *
+ *    This Library is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This Library is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this Library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sous_ensembles.h"
+#include "outils.h"
+
+int test_ajouter_sous_ensemble(){
+	int result = 1;
+	int nouveau;
+	Sous_ensembles dictionnaire;
+	initialiser_sous_ensembles( &dictionnaire );
+
+	int a[] = { 1, 4, 7 };
+	int b[] = { 1, 4 };
+	int c[] = { 1, 4, 7 };
+
+	// TEST évalue deux fois son argument : on garde les numéros à part.
+	int numero = ajouter_sous_ensemble( &dictionnaire, a, 3, &nouveau );
+	TEST( numero == 0 && nouveau, result );
+	numero = ajouter_sous_ensemble( &dictionnaire, b, 2, &nouveau );
+	TEST( numero == 1 && nouveau, result );
+	numero = ajouter_sous_ensemble( &dictionnaire, c, 3, &nouveau );
+	TEST( numero == 0 && ! nouveau, result );
+	numero = ajouter_sous_ensemble( &dictionnaire, NULL, 0, &nouveau );
+	TEST( numero == 2 && nouveau, result );
+	numero = ajouter_sous_ensemble( &dictionnaire, b, 0, NULL );
+	TEST( numero == 2, result );
+	TEST( nb_sous_ensembles( &dictionnaire ) == 3, result );
+
+	int nb;
+	const int * elements = get_sous_ensemble( &dictionnaire, 1, &nb );
+	TEST( nb == 2 && elements[0] == 1 && elements[1] == 4, result );
+	get_sous_ensemble( &dictionnaire, 2, &nb );
+	TEST( nb == 0, result );
+
+	detruire_sous_ensembles( &dictionnaire );
+	return result;
+}
+
+int test_beaucoup_de_sous_ensembles(){
+	int result = 1;
+	Sous_ensembles dictionnaire;
+	initialiser_sous_ensembles( &dictionnaire );
+
+	// Tous les sous-ensembles de {0, ..., 11}, deux fois.
+	int elements[12];
+	for( int fois=0; fois<2; fois++ ){
+		for( int s=0; s < ( 1 << 12 ); s++ ){
+			int nb = 0;
+			for( int i=0; i<12; i++ ){
+				if( s & ( 1 << i ) ) elements[nb++] = i;
+			}
+			int nouveau;
+			int numero = ajouter_sous_ensemble( &dictionnaire, elements, nb, &nouveau );
+			TEST( numero == s, result );
+			TEST( nouveau == ( fois == 0 ), result );
+		}
+	}
+	TEST( nb_sous_ensembles( &dictionnaire ) == 1 << 12, result );
+	int absent[] = { 3, 12 };
+	TEST( trouver_sous_ensemble( &dictionnaire, absent, 2 ) == -1, result );
+	TEST( trouver_sous_ensemble( &dictionnaire, absent, 1 ) == 8, result );
+
+	detruire_sous_ensembles( &dictionnaire );
+	return result;
+}
+
+int main(){
+	int result = 1;
+
+	result &= test_ajouter_sous_ensemble();
+	result &= test_beaucoup_de_sous_ensembles();
+
+	if( ! result ){
+		fprintf( stderr, "Certains tests du fichier %s ont échoués.\n", __FILE__ );
+		return 1;
+	}
+
+	return 0;
+}
@@ -395,6 +395,136 @@ int test_trouver_table(){
 	return result;
 }
 
+int test_trouver_valeur_table(){
+	int result = 1;
+	intptr_t valeur = 0;
+	Table * table = creer_table( NULL, NULL, NULL );
+
+	add_table( table, 1, 11 );
+	add_table( table, 3, 33 );
+
+	TEST( trouver_valeur_table( table, 3, &valeur ) && valeur == 33, result );
+	TEST( trouver_valeur_table( table, 1, NULL ), result );
+	TEST( ! trouver_valeur_table( table, 2, &valeur ) && valeur == 33, result );
+
+	liberer_table( table );
+
+	// La clé donnée à la recherche n'est pas copiée : elle peut être sur la 
+	// pile.
+	table = creer_table( 
+		(int (*)( const intptr_t, const intptr_t )) comparer_cle, 
+		(intptr_t (*)( const intptr_t )) copier_cle, 
+		(void (*)(intptr_t)) supprimer_cle 
+	);
+
+	Cle cle;
+	initialiser_cle( &cle, 4 ); 	
+	add_table( table, (intptr_t) &cle, 44 );
+	add_table( table, (intptr_t) &cle, 45 );
+	initialiser_cle( &cle, 7 ); 	
+	TEST( ! trouver_valeur_table( table, (intptr_t) &cle, &valeur ), result );
+	initialiser_cle( &cle, 4 ); 	
+	TEST( trouver_valeur_table( table, (intptr_t) &cle, &valeur ) && valeur == 45, result );
+	TEST( delete_table( table, (intptr_t) &cle ) == 45, result );
+	TEST( ! trouver_valeur_table( table, (intptr_t) &cle, &valeur ), result );
+	TEST( delete_table( table, (intptr_t) &cle ) == (intptr_t) NULL, result );
+
+	liberer_table( table );
+	return result;
+}
+
+int test_trouver_table_a_partir(){
+	int result = 1;
+	Table * table = creer_table( NULL, NULL, NULL );
+
+	TEST( iterateur_est_vide( trouver_table_a_partir( table, 0 ) ), result );
+
+	for( int i=0; i<200; i++ ){
+		add_table( table, 3*i, i );
+	}
+	int ok = 1;
+	for( int cle = -5; cle < 600; cle++ ){
+		Table_iterateur it = trouver_table_a_partir( table, cle );
+		int attendue = cle <= 0 ? 0 : ( ( cle + 2 ) / 3 ) * 3;
+		if( attendue > 597 ){
+			ok &= iterateur_est_vide( it );
+			continue;
+		}
+		ok &= ! iterateur_est_vide( it ) && get_cle( it ) == attendue;
+		// La suite du parcours est celle de la table.
+		it = iterateur_suivant_table( it );
+		if( attendue + 3 > 597 ){
+			ok &= iterateur_est_vide( it );
+		}else{
+			ok &= ! iterateur_est_vide( it ) && get_cle( it ) == attendue + 3;
+		}
+	}
+	TEST( ok, result );
+
+	liberer_table( table );
+	return result;
+}
+
+int test_remplir_table_triee(){
+	int result = 1;
+	intptr_t cles[100], valeurs[100];
+	intptr_t valeur = 0;
+	Table * table = creer_table( NULL, NULL, NULL );
+
+	for( int i=0; i<100; i++ ){
+		cles[i] = 2*i;
+		valeurs[i] = 3*i;
+	}
+	remplir_table_triee( table, cles, valeurs, 100 );
+
+	TEST( taille_table( table ) == 100, result );
+	TEST( trouver_valeur_table( table, 42, &valeur ) && valeur == 63, result );
+	TEST( ! trouver_valeur_table( table, 43, NULL ), result );
+	TEST( get_cle( premier_iterateur_table( table ) ) == 0, result );
+
+	// L'arbre construit reste un AVL valide pour les insertions et
+	// suppressions qui suivent.
+	for( int i=0; i<100; i++ ){
+		add_table( table, 2*i+1, i );
+		delete_table( table, 4*i );
+	}
+	TEST( taille_table( table ) == 150, result );
+	int precedent = -1;
+	Table_iterateur it;
+	for(
+		it = premier_iterateur_table( table );
+		! iterateur_est_vide( it );
+		it = iterateur_suivant_table( it )
+	){
+		TEST( get_cle( it ) > precedent, result );
+		TEST( get_cle( it ) % 4 != 0, result );
+		precedent = get_cle( it );
+	}
+
+	liberer_table( table );
+
+	// Les clés sont copiées, comme avec add_table().
+	table = creer_table( 
+		(int (*)( const intptr_t, const intptr_t )) comparer_cle, 
+		(intptr_t (*)( const intptr_t )) copier_cle, 
+		(void (*)(intptr_t)) supprimer_cle 
+	);
+	Cle tab_cles[3];
+	for( int i=0; i<3; i++ ){
+		initialiser_cle( &tab_cles[i], i );
+		cles[i] = (intptr_t) &tab_cles[i];
+	}
+	remplir_table_triee( table, cles, NULL, 3 );
+	TEST( taille_table( table ) == 3, result );
+	TEST( get_cle( premier_iterateur_table( table ) ) != cles[0], result );
+	Cle cle;
+	initialiser_cle( &cle, 2 );
+	TEST( trouver_valeur_table( table, (intptr_t) &cle, &valeur ) && valeur == 0, result );
+	liberer_table( table );
+
+	return result;
+}
+
 int test_get_cle(){
 	// Voir general_test
 	return 1;
@@ -420,6 +550,9 @@ int main(){
 	result &= test_pour_toute_valeur_table();
 	result &= test_pour_toute_cle_valeur_table();
 	result &= test_trouver_table();
+	result &= test_trouver_table_a_partir();
+	result &= test_trouver_valeur_table();
+	result &= test_remplir_table_triee();
 	result &= test_get_cle();
 	result &= test_get_valeur();
 